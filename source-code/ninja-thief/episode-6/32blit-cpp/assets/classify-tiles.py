@@ -0,0 +1,112 @@
+#!/bin/env python3
+from PIL import Image
+import sys
+import pathlib
+
+# Run with `./classify-tiles.py spritesheet.png tile_info.hpp`
+# This is run automatically by CMake whenever the spritesheet changes
+IMAGE_PATH = pathlib.Path(sys.argv[1])
+OUTPUT_PATH = pathlib.Path(sys.argv[2])
+
+TILE_SIZE = 8
+
+TRANSPARENT = "TRANSPARENT"
+OPAQUE = "OPAQUE"
+MASKED = "MASKED"
+BLENDED = "BLENDED"
+
+
+def classify_tile(image, tile_x, tile_y):
+    """Returns the type of a tile, along with the visible span and opaque pixel mask of each row."""
+    spans = []
+    masks = []
+
+    any_visible = False
+    any_transparent = False
+    any_blended = False
+
+    for y in range(TILE_SIZE):
+        alphas = [image.getpixel((tile_x + x, tile_y + y))[3] for x in range(TILE_SIZE)]
+
+        visible = [x for x, a in enumerate(alphas) if a > 0]
+
+        # Empty rows have a span of (0, 0)
+        spans.append((visible[0], visible[-1] + 1) if visible else (0, 0))
+        masks.append(sum(1 << x for x, a in enumerate(alphas) if a == 255))
+
+        any_visible |= len(visible) > 0
+        any_transparent |= any(a < 255 for a in alphas)
+        any_blended |= any(0 < a < 255 for a in alphas)
+
+    if not any_visible:
+        tile_type = TRANSPARENT
+    elif not any_transparent:
+        tile_type = OPAQUE
+    elif not any_blended:
+        tile_type = MASKED
+    else:
+        tile_type = BLENDED
+
+    return tile_type, spans, masks
+
+
+img = Image.open(IMAGE_PATH).convert("RGBA")
+w, h = img.size
+
+tiles = [classify_tile(img, x, y) for y in range(0, h, TILE_SIZE) for x in range(0, w, TILE_SIZE)]
+
+lines = [
+    f"// Generated from {IMAGE_PATH.name} by {pathlib.Path(__file__).name} - don't edit this file by hand",
+    "#pragma once",
+    "",
+    "#include <cstdint>",
+    "",
+    "namespace TileInfo {",
+    "    // How the pixels of a tile need to be drawn",
+    "    enum Type : uint8_t {",
+    "        TRANSPARENT, // Every pixel is transparent, so the tile can be skipped",
+    "        OPAQUE,      // Every pixel is opaque, so the tile can be copied straight across",
+    "        MASKED,      // Every pixel is either fully transparent or fully opaque, so only the opaque pixels need copying",
+    "        BLENDED      // Some pixels are partially transparent, so they need blending with whatever is underneath",
+    "    };",
+    "",
+    f"    const uint8_t TILE_SIZE = {TILE_SIZE};",
+    f"    const uint8_t COUNT = {len(tiles)};",
+    "",
+    "    const Type TYPES[COUNT] = {",
+]
+
+for i, (tile_type, _, _) in enumerate(tiles):
+    lines.append(f"        {tile_type}, // {i}")
+
+lines += [
+    "    };",
+    "",
+    "    // The first visible column and one past the last visible column in each row of a tile (both are 0 if the row is empty)",
+    "    const uint8_t ROW_SPANS[COUNT][TILE_SIZE][2] = {",
+]
+
+for _, spans, _ in tiles:
+    lines.append("        {" + ", ".join(f"{{{start}, {end}}}" for start, end in spans) + "},")
+
+lines += [
+    "    };",
+    "",
+    "    // Which pixels in each row of a tile are fully opaque (the leftmost pixel is the lowest bit)",
+    "    const uint8_t ROW_MASKS[COUNT][TILE_SIZE] = {",
+]
+
+for _, _, masks in tiles:
+    lines.append("        {" + ", ".join(f"0x{mask:02x}" for mask in masks) + "},")
+
+lines += [
+    "    };",
+    "}",
+    "",
+]
+
+with open(OUTPUT_PATH, "w") as f:
+    f.write("\n".join(lines))
+
+print(f"Classified {len(tiles)} tiles from {IMAGE_PATH.name}: " + ", ".join(
+    f"{sum(1 for t in tiles if t[0] == tile_type)} {tile_type.lower()}" for tile_type in (TRANSPARENT, OPAQUE, MASKED, BLENDED)))
@@ -0,0 +1,158 @@
+#!/bin/env python3
+import re
+import sys
+import pathlib
+
+# Run with `./pack-levels.py [--raw] constants.hpp packed_levels.hpp [levels.pack]`
+# Outputs ending in .hpp are written as C++ arrays, and anything else is written as a binary file which the game can load
+# The .hpp output also holds the spawn list of each level on its own, which is used when the game isn't using a level pack
+# With --raw, the layers are stored uncompressed so that they can be used straight from the pack, without being decoded into RAM
+# This is run automatically by CMake whenever the levels in constants.hpp change
+RAW = "--raw" in sys.argv
+ARGUMENTS = [argument for argument in sys.argv[1:] if argument != "--raw"]
+CONSTANTS_PATH = pathlib.Path(ARGUMENTS[0])
+OUTPUT_PATHS = [pathlib.Path(path) for path in ARGUMENTS[1:]]
+
+TILE_COUNT = 15 * 15
+LAYER_COUNT = 4
+BLANK_TILE = 0xff
+
+# Used in the spawn list when a level has no player spawn
+NO_SPAWN = 0xff
+
+# Level numbers are stored in a uint8_t, and 255 is used by the game to mean "no level"
+MAX_LEVELS = 255
+
+# Set in the pack's flags if the layers are stored uncompressed
+FLAG_RAW = 0x01
+
+
+def read_constant(source, name):
+    """Returns the value of an integer constant defined in constants.hpp."""
+    return int(re.search(rf"{name} = (\w+);", source).group(1), 0)
+
+
+def read_levels(path):
+    """Returns the tiles of every level in Constants::LEVELS, as a list of layers for each level."""
+    source = path.read_text()
+
+    start = source.index("LEVELS[LEVEL_COUNT]")
+    end = source.index("};", start)
+
+    tiles = [int(value, 16) for value in re.findall(r"0x[0-9a-fA-F]{2}", source[start:end])]
+
+    if len(tiles) % (TILE_COUNT * LAYER_COUNT) != 0:
+        sys.exit(f"{path.name} has {len(tiles)} level tiles, which isn't a whole number of levels")
+
+    layers = [tiles[i:i + TILE_COUNT] for i in range(0, len(tiles), TILE_COUNT)]
+
+    return [layers[i:i + LAYER_COUNT] for i in range(0, len(layers), LAYER_COUNT)]
+
+
+def pack_spawns(entity_spawns):
+    """Lists the tiles which the player and enemies spawn on, as (player tile, enemy count, enemy tiles...)."""
+    # If there's more than one player spawn, the last one is used (in the same way as searching the layer did)
+    player_tiles = [i for i, tile in enumerate(entity_spawns) if tile == PLAYER_SPAWN]
+    enemy_tiles = [i for i, tile in enumerate(entity_spawns) if tile == ENEMY_SPAWN]
+
+    return [player_tiles[-1] if player_tiles else NO_SPAWN, len(enemy_tiles)] + enemy_tiles
+
+
+def pack_layer(layer):
+    """Encodes a layer as (blank count, tile count, tiles...) runs, which cover every tile in order."""
+    data = []
+    i = 0
+
+    while i < TILE_COUNT:
+        blank_start = i
+
+        while i < TILE_COUNT and layer[i] == BLANK_TILE:
+            i += 1
+
+        tiles_start = i
+
+        while i < TILE_COUNT and layer[i] != BLANK_TILE:
+            i += 1
+
+        # A layer only has 225 tiles, so both counts always fit in a byte
+        data += [tiles_start - blank_start, i - tiles_start] + layer[tiles_start:i]
+
+    return data
+
+
+levels = read_levels(CONSTANTS_PATH)
+
+constants = CONSTANTS_PATH.read_text()
+PLAYER_SPAWN = read_constant(constants, "PLAYER_IDLE")
+ENEMY_SPAWN = PLAYER_SPAWN + read_constant(constants, "RED_OFFSET")
+
+if len(levels) > MAX_LEVELS:
+    sys.exit(f"{CONSTANTS_PATH.name} has {len(levels)} levels, but a pack can only hold {MAX_LEVELS}")
+
+# Each level starts with its spawn list (the entity spawns are the third layer), followed by its layers
+if RAW:
+    packed_levels = [pack_spawns(level[2]) + sum(level, []) for level in levels]
+else:
+    packed_levels = [pack_spawns(level[2]) + sum((pack_layer(layer) for layer in level), []) for level in levels]
+
+# The pack starts with the number of levels and its flags, followed by the offset of each level from the start of the pack (plus one more for the end of the last level)
+header_size = 2 + (len(levels) + 1) * 4
+
+offsets = [header_size]
+for packed_level in packed_levels:
+    offsets.append(offsets[-1] + len(packed_level))
+
+data = [len(levels), FLAG_RAW if RAW else 0]
+for offset in offsets:
+    data += list(offset.to_bytes(4, "little"))
+
+for packed_level in packed_levels:
+    data += packed_level
+
+# The spawn lists on their own, in the same format as in the pack, with the offset of each one (plus the end of the last one)
+spawn_lists = [pack_spawns(level[2]) for level in levels]
+
+spawn_offsets = [0]
+for spawn_list in spawn_lists:
+    spawn_offsets.append(spawn_offsets[-1] + len(spawn_list))
+
+spawn_data = sum(spawn_lists, [])
+
+lines = [
+    f"// Generated from {CONSTANTS_PATH.name} by {pathlib.Path(__file__).name} - don't edit this file by hand",
+    "#pragma once",
+    "",
+    "#include <cstdint>",
+    "",
+    f"// {len(levels)} levels, {'stored uncompressed' if RAW else 'packed'} in {len(data)} bytes (from {len(levels) * LAYER_COUNT * TILE_COUNT} bytes)",
+    f"const uint8_t PACKED_LEVELS[{len(data)}] = {{",
+]
+
+for i in range(0, len(data), 16):
+    lines.append("    " + ", ".join(f"0x{byte:02x}" for byte in data[i:i + 16]) + ",")
+
+lines += [
+    "};",
+    "",
+    "// The spawn list of each level, so that levels used straight from Constants::LEVELS don't need to search their entity spawn layer",
+    f"const uint8_t LEVEL_SPAWNS[{len(spawn_data)}] = {{",
+]
+
+for i in range(0, len(spawn_data), 16):
+    lines.append("    " + ", ".join(f"0x{byte:02x}" for byte in spawn_data[i:i + 16]) + ",")
+
+lines += [
+    "};",
+    "",
+    f"const uint16_t LEVEL_SPAWN_OFFSETS[{len(spawn_offsets)}] = {{ " + ", ".join(str(offset) for offset in spawn_offsets) + " };",
+    "",
+]
+
+for path in OUTPUT_PATHS:
+    if path.suffix == ".hpp":
+        path.write_text("\n".join(lines))
+    else:
+        path.write_bytes(bytes(data))
+
+print(f"Packed {len(levels)} levels from {CONSTANTS_PATH.name}: {len(data)} bytes, " + ", ".join(
+    f"level {i + 1} {len(packed_level)}" for i, packed_level in enumerate(packed_levels)))
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <cstdlib>
+#include <vector>
+
+#include "32blit.hpp"
+
+#include "ninja.hpp"
+#include "render_queue.hpp"
+#include "spatial_grid.hpp"
+#include "tile_masks.hpp"
+#include "constants.hpp"
+
+// All the enemies in a level, stored as one array per property (rather than an array of ninja objects)
+// Each update works through the whole array for one step at a time (thinking, moving, then collisions), so the moving step can be vectorised
+class Enemies {
+public:
+	// Adds an enemy at the position provided, facing in a random direction and with a random speed
+	void add(number_t x, number_t y);
+
+	// Makes space for the number of enemies provided, so that adding and updating them doesn't need to reallocate the arrays (or the grid)
+	void reserve(uint32_t count);
+
+	// Adds enemies at each of the level's enemy spawn positions in turn, until there are the number of enemies provided
+	// This is used to fill levels with far more enemies than they were designed for
+	void fill(const Constants::LevelData& level_data, uint32_t count);
+
+	uint32_t count();
+
+	// Returns the number of bytes allocated for the enemy arrays and grid (these never shrink, so this is also the most they have used)
+	uint32_t get_memory_usage();
+
+	// Sets the point which decides how often each enemy is updated (this should be the player's position)
+	// If ENEMY_LOD is defined, enemies far from this point are only updated every few ticks
+	void set_focus(number_t x, number_t y);
+
+	void update(number_t dt, TileMasks& tile_masks);
+
+	// Queues every enemy's sprite to be drawn, part way between its previous and current positions
+	void render(RenderQueue& render_queue, number_t interpolation);
+
+	// Returns true if any enemy is touching the ninja provided
+	// Only the enemies in the grid cells around the ninja are checked exactly, using their positions from the end of the last update
+	bool check_colliding(Ninja& ninja);
+
+	// Returns the number of enemies which have been checked exactly by check_colliding since the last call, then resets the count
+	uint32_t take_narrow_phase_tests();
+
+	// Returns the area of the screen covered by an enemy's sprite, when drawn with the interpolation provided
+	blit::Rect get_render_rect(uint32_t index, number_t interpolation);
+
+	// Returns the area of the screen which was covered by an enemy's sprite when it was last rendered
+	blit::Rect get_last_render_rect(uint32_t index);
+
+	// Times updating levels filled with thousands of enemies
+	// This is only used if BENCHMARK_ENEMIES is defined
+	static void benchmark_update();
+
+private:
+#ifdef ENEMY_LOD
+	// Works out how far each enemy should be moved this tick: enemies near the focus point move every tick, and the others move a few ticks' worth at once every few ticks
+	void choose_steps(number_t dt);
+#endif
+
+	// Decides which way each patrolling enemy should walk, and whether it should start climbing a ladder
+	void think(TileMasks& tile_masks);
+
+	// Applies gravity to enemies which aren't climbing, moves every enemy, and stops them from going off the sides
+	void move(number_t dt);
+
+	// Resolves collisions with platforms and ladders, one enemy at a time
+	void handle_collisions(TileMasks& tile_masks);
+
+	// Returns true if there is a platform tile which is one block below and just in front of the enemy
+	// This is used to work out when the enemy reaches the end of a platform
+	bool platform_ahead(TileMasks& tile_masks, uint32_t index);
+
+	// Returns true if there is a ladder tile above or below the enemy's centre
+	bool ladder_above_or_below(TileMasks& tile_masks, uint32_t index, Ninja::VerticalDirection direction);
+
+	// Returns true if the tile at the position provided is set in the mask
+	static bool tile_at_position(const TileMasks& tile_masks, TileMasks::Mask mask, number_t x, number_t y);
+
+	// Returns a boolean, with chance of being true equal to probability supplied
+	static bool random_bool(number_t probability);
+
+	// Returns a random number between 0 (inclusive) and 1 (exclusive)
+	static number_t random_fraction();
+
+	enum class AIState : uint8_t {
+		PATROLLING,
+		CLIMBING
+	};
+
+	// Bits used in the flags array
+	enum Flags : uint8_t {
+		CAN_CLIMB = 1 << 0,
+		CLIMB_NEXT_LADDER = 1 << 1,
+		FACING_LEFT = 1 << 2
+	};
+
+	std::vector<number_t> position_x;
+	std::vector<number_t> position_y;
+	std::vector<number_t> velocity_x;
+	std::vector<number_t> velocity_y;
+
+	// Positions at the start of each enemy's last step, used to draw the enemies between ticks
+	std::vector<number_t> previous_x;
+	std::vector<number_t> previous_y;
+
+	std::vector<number_t> speed;
+	std::vector<int8_t> direction;
+	std::vector<AIState> ai_state;
+	std::vector<Ninja::ClimbingState> climbing_state;
+	std::vector<uint8_t> flags;
+
+	std::vector<blit::Rect> last_render_rects;
+
+	// Rebuilt at the end of each update, so that check_colliding doesn't need to look at every enemy
+	SpatialGrid grid;
+
+	uint32_t narrow_phase_tests = 0;
+
+	// The position which decides how often each enemy is updated (only used if ENEMY_LOD is defined)
+	number_t focus_x = Constants::GAME_WIDTH / 2;
+	number_t focus_y = Constants::GAME_HEIGHT / 2;
+
+#ifdef ENEMY_LOD
+	// The length of time each enemy is being moved by this tick (0 if it is skipping this tick)
+	std::vector<number_t> steps;
+
+	// How many ticks each enemy's last step covers, and how many ticks have passed since it was taken
+	// Far-away enemies are drawn moving across the whole of their step, instead of only moving on the ticks they are updated
+	std::vector<uint8_t> step_ticks;
+	std::vector<uint8_t> ticks_since_step;
+
+	// Counts the ticks, so that the far-away enemies can take turns to be updated
+	uint8_t lod_tick = 0;
+#endif
+
+	// The collision code works on a single ninja, so each enemy is copied into this one in turn
+	Ninja collider = Ninja(Ninja::Colour::RED, 0, 0);
+};
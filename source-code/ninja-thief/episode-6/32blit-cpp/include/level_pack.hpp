@@ -0,0 +1,110 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "32blit.hpp"
+
+#include "constants.hpp"
+
+// Reads levels from a pack made by assets/pack-levels.py, which stores each layer as runs of blank tiles followed by runs of other tiles
+// Most of each layer is blank, so this is around a quarter of the size of the LevelData it expands into
+// Packs made with --raw store the layers of each level as an uncompressed LevelData instead, so that a pack in memory can be used in place without decoding
+//
+// The pack starts with the number of levels and the pack's flags (one byte each), then the offset of each level from the start of the pack, plus the offset of the end of the last level (four bytes each, little-endian)
+// Each level is its spawn list (player tile, enemy count, enemy tiles...), followed by its four layers in the same order as LevelData
+// Each layer is a list of (blank count, tile count, tiles...) runs which covers all of its tiles
+class LevelPack {
+public:
+	// The tiles which the player and enemies start on, so that loading a level doesn't need to search the whole entity spawn layer
+	// Each tile is stored as its index in the level's layers (y * GAME_WIDTH_TILES + x)
+	struct SpawnList {
+		static const uint8_t NO_SPAWN = 0xff;
+
+		uint8_t player = NO_SPAWN;
+
+		uint8_t enemy_count = 0;
+		uint8_t enemies[Constants::GAME_WIDTH_TILES * Constants::GAME_HEIGHT_TILES];
+	};
+
+	LevelPack();
+	LevelPack(const uint8_t* _data);
+
+	// Opens a pack file, which can be on the SD card or a buffer file added with blit::File::add_buffer_file
+	// If the file is already in memory (a buffer file, or a file in flash), the pack is used from there without being copied, otherwise only the header is read now, and each level is read from the file when it's loaded
+	// Returns false (and leaves the pack empty) if the file can't be opened or isn't a valid pack (including if any spawn list has tiles outside its level)
+	bool open(const std::string& filename);
+
+	uint8_t get_level_count() const;
+
+	// Returns true if the levels are stored uncompressed
+	bool is_raw() const;
+
+	// Returns the number of bytes used by the whole pack, or by one level in it
+	uint32_t get_size() const;
+	uint32_t get_size(uint8_t level_number) const;
+
+	// Returns the layers of a level, and copies its spawn list into spawns
+	// If the pack is raw and in memory, this points straight at the level in the pack, otherwise the level is decoded (or read from the file) into level_data, and this points to level_data
+	const Constants::LevelData* load(uint8_t level_number, Constants::LevelData& level_data, SpawnList& spawns);
+
+	// Copies a level's spawn list into spawns, without loading its layers
+	void load_spawns(uint8_t level_number, SpawnList& spawns);
+
+	// Returns the number of bytes of RAM allocated for reading a pack file (not including the LevelData which levels are loaded into)
+	uint32_t get_memory_usage() const;
+
+	// Copies the spawn list of one of the levels in Constants::LEVELS, which is generated with the built-in pack when the game is built
+	// This is used instead of searching the entity spawn layer when levels aren't loaded from a pack
+	static void load_built_in_spawns(uint8_t level_number, SpawnList& spawns);
+
+	// Returns the pack which is built into the game, generated from Constants::LEVELS
+	// This is only used if LEVEL_PACK or BENCHMARK_LEVEL_PACK is defined, so that other builds don't include a second copy of the levels
+	static LevelPack built_in();
+
+	// Times loading each level of the built-in pack, and checks that it matches Constants::LEVELS
+	// Then compares the time and RAM needed to load every level from Constants::LEVELS, the built-in pack, the built-in pack opened as a buffer file, and the level pack file (if there is one)
+	// This is only used if BENCHMARK_LEVEL_PACK is defined
+	static void benchmark_loading();
+
+private:
+	static const uint8_t FLAG_RAW = 0x01;
+
+	// Returns the size of the header for a pack with level_count levels
+	static uint32_t get_header_size(uint8_t level_count);
+
+	// Returns the offset of a level from the start of the pack (index can be the level count, to get the end of the last level)
+	uint32_t get_offset(uint8_t index) const;
+
+	// Checks that the offsets in the header are in order, fit in a pack of the length given, and that raw levels are big enough to hold a LevelData
+	bool check_header(uint32_t length) const;
+
+	// Checks that every level's spawn list fits in the level, and only has tiles which are inside the level
+	// This reads every level, so that a damaged pack file is rejected when it's opened rather than part way through the game
+	bool check_spawn_lists();
+
+	// Returns the start of a level in the pack, reading it into level_buffer first if the pack isn't in memory
+	const uint8_t* get_level(uint8_t level_number);
+
+	// Copies a level's spawn list into spawns, and returns its size in bytes
+	// The enemy count is cut short if the list would go past the end of the level, so that a damaged pack can't read out of bounds, and any tiles outside the level are left out
+	static uint32_t read_spawns(const uint8_t* source, uint32_t size, SpawnList& spawns);
+
+	// Expands a packed level into level_data, reading it in one pass from start to end
+	// Any tiles not covered by the runs are left blank, and runs which go past the end of a layer or the packed level are cut short, so that a damaged pack can't write or read out of bounds
+	static void decode(const uint8_t* source, uint32_t size, Constants::LevelData& level_data);
+
+	// Times loading every level from the pack, and prints the results
+	void benchmark(const char* name);
+
+	// The whole pack if it's in memory, otherwise nullptr
+	const uint8_t* data = nullptr;
+
+	// If the pack is being read from a file which isn't in memory, this holds the pack's header, and level_buffer holds the level being loaded
+	blit::File file;
+	std::vector<uint8_t> header;
+	std::vector<uint8_t> level_buffer;
+};
@@ -0,0 +1,10 @@
+#include <algorithm>
+#include <cstdlib>
+#include <ctime>
+
+#include "32blit.hpp"
+
+#include "constants.hpp"
+#include "level.hpp"
+
+#include "assets.hpp"
\ No newline at end of file
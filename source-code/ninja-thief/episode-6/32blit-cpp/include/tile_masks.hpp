@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+
+#include "constants.hpp"
+
+// Stores which tiles of a level are platforms, ladders, coins and gems, using one uint16_t per row of tiles (bit x is set if column x has that tile)
+// These are worked out from the level data when a level is loaded, so that the collision checks only need shifts and masks
+class TileMasks {
+public:
+	enum class Mask : uint8_t {
+		// Platforms which can be hit from any side
+		SOLID,
+
+		// Platforms with a ladder in front of them, which can only be landed on from above
+		ONE_WAY,
+
+		// Both kinds of platform, so that they can be checked at once
+		PLATFORM,
+
+		LADDER,
+		COIN,
+		GEM,
+
+		COUNT
+	};
+
+	TileMasks();
+	TileMasks(const Constants::LevelData& level_data);
+
+	// Returns the row of the mask provided, with a bit set for each column containing that tile
+	uint16_t row(Mask mask, uint8_t y) const {
+		return rows[static_cast<uint8_t>(mask)][y];
+	}
+
+	// Returns true if the tile is set in the mask provided (tiles outside the game area are never set)
+	bool has(Mask mask, int32_t x, int32_t y) const {
+		return x >= 0 && x < Constants::GAME_WIDTH_TILES && y >= 0 && y < Constants::GAME_HEIGHT_TILES && (row(mask, y) >> x) & 1;
+	}
+
+	// Removes a tile from the mask provided (used when a coin or gem is collected)
+	void clear(Mask mask, uint8_t x, uint8_t y) {
+		rows[static_cast<uint8_t>(mask)][y] &= ~(1 << x);
+	}
+
+	// Returns the number of tiles set in the mask provided
+	uint8_t count(Mask mask) const;
+
+private:
+	uint16_t rows[static_cast<uint8_t>(Mask::COUNT)][Constants::GAME_HEIGHT_TILES] = {};
+};
@@ -0,0 +1,442 @@
+#include "enemies.hpp"
+
+using namespace blit;
+
+void Enemies::add(number_t x, number_t y) {
+	position_x.push_back(x);
+	position_y.push_back(y);
+	velocity_x.push_back(0);
+	velocity_y.push_back(0);
+	previous_x.push_back(x);
+	previous_y.push_back(y);
+
+	direction.push_back(std::rand() % 2 ? 1 : -1);
+	speed.push_back(Constants::Enemy::MIN_SPEED + (Constants::Enemy::MAX_SPEED - Constants::Enemy::MIN_SPEED) * random_fraction());
+
+	ai_state.push_back(AIState::PATROLLING);
+	climbing_state.push_back(Ninja::ClimbingState::NONE);
+	flags.push_back(0);
+
+	last_render_rects.push_back(Rect());
+
+#ifdef ENEMY_LOD
+	step_ticks.push_back(1);
+	ticks_since_step.push_back(0);
+#endif
+}
+
+void Enemies::reserve(uint32_t count) {
+	position_x.reserve(count);
+	position_y.reserve(count);
+	velocity_x.reserve(count);
+	velocity_y.reserve(count);
+	previous_x.reserve(count);
+	previous_y.reserve(count);
+	direction.reserve(count);
+	speed.reserve(count);
+	ai_state.reserve(count);
+	climbing_state.reserve(count);
+	flags.reserve(count);
+	last_render_rects.reserve(count);
+
+#ifdef ENEMY_LOD
+	steps.reserve(count);
+	step_ticks.reserve(count);
+	ticks_since_step.reserve(count);
+#endif
+
+	grid.reserve(count);
+}
+
+void Enemies::fill(const Constants::LevelData& level_data, uint32_t count) {
+	reserve(count);
+
+	bool spawn_found = true;
+
+	while (this->count() < count && spawn_found) {
+		spawn_found = false;
+
+		for (uint8_t i = 0; i < Constants::GAME_WIDTH_TILES * Constants::GAME_HEIGHT_TILES && this->count() < count; i++) {
+			if (level_data.entity_spawns[i] == Constants::Sprites::PLAYER_IDLE + Constants::Sprites::RED_OFFSET) {
+				add((i % Constants::GAME_WIDTH_TILES) * Constants::SPRITE_SIZE, (i / Constants::GAME_WIDTH_TILES) * Constants::SPRITE_SIZE);
+				spawn_found = true;
+			}
+		}
+	}
+}
+
+uint32_t Enemies::count() {
+	return position_x.size();
+}
+
+uint32_t Enemies::get_memory_usage() {
+	uint32_t capacity = position_x.capacity();
+
+	// Every array is reserved and grown together, so they all have the same capacity
+	uint32_t bytes_per_enemy = sizeof(number_t) * 7 + sizeof(int8_t) + sizeof(AIState) + sizeof(Ninja::ClimbingState) + sizeof(uint8_t) + sizeof(last_render_rects[0]);
+
+	uint32_t memory_usage = capacity * bytes_per_enemy + grid.get_memory_usage();
+
+#ifdef ENEMY_LOD
+	memory_usage += steps.capacity() * sizeof(number_t) + step_ticks.capacity() + ticks_since_step.capacity();
+#endif
+
+	return memory_usage;
+}
+
+void Enemies::set_focus(number_t x, number_t y) {
+	focus_x = x;
+	focus_y = y;
+}
+
+void Enemies::update(number_t dt, TileMasks& tile_masks) {
+#ifdef ENEMY_LOD
+	choose_steps(dt);
+#endif
+
+	think(tile_masks);
+	move(dt);
+	handle_collisions(tile_masks);
+
+	grid.rebuild(position_x.data(), position_y.data(), count());
+}
+
+#ifdef ENEMY_LOD
+void Enemies::choose_steps(number_t dt) {
+	steps.resize(count());
+
+	for (uint32_t i = 0; i < count(); i++) {
+		// Enemies which are part way through a long step finish it before they go back to being updated every tick, so that they don't jump to the end of it
+		bool mid_step = ticks_since_step[i] + 1 < step_ticks[i];
+
+		bool far = mid_step || absolute(position_x[i] - focus_x) > Constants::Enemy::LOD_DISTANCE || absolute(position_y[i] - focus_y) > Constants::Enemy::LOD_DISTANCE;
+
+		// Each step covers all the ticks since the enemy last moved (including this one), so that it never gets ahead of or behind the other enemies
+		// This is only a whole LOD_TICK_INTERVAL for enemies which have been far away since their last step, since an enemy which has just moved away from the focus point might have stepped on the last tick
+		uint8_t ticks = ticks_since_step[i] + 1;
+
+		// The far-away enemies are spread over the ticks, so that the same number are updated each tick
+		bool moving = !far || (lod_tick + i) % Constants::Enemy::LOD_TICK_INTERVAL == 0;
+
+		steps[i] = moving ? dt * ticks : number_t(0);
+
+		// Keep track of how far through its step each enemy is, so that it can be drawn moving across the whole step
+		if (moving) {
+			step_ticks[i] = ticks;
+			ticks_since_step[i] = 0;
+		}
+		else {
+			ticks_since_step[i]++;
+		}
+	}
+
+	lod_tick = (lod_tick + 1) % Constants::Enemy::LOD_TICK_INTERVAL;
+}
+#endif
+
+void Enemies::think(TileMasks& tile_masks) {
+	for (uint32_t i = 0; i < count(); i++) {
+		if (ai_state[i] != AIState::PATROLLING) {
+			continue;
+		}
+
+#ifdef ENEMY_LOD
+		if (steps[i] == 0) {
+			continue;
+		}
+#endif
+
+		if (!platform_ahead(tile_masks, i)) {
+			// No platform ahead, so turn around
+			direction[i] = -direction[i];
+		}
+
+		velocity_x[i] = speed[i] * direction[i];
+
+		if (flags[i] & CAN_CLIMB) {
+			if (flags[i] & CLIMB_NEXT_LADDER) {
+				// We're allowed to climb - check both directions for a ladder tile
+				bool can_go_up = ladder_above_or_below(tile_masks, i, Ninja::VerticalDirection::UP);
+				bool can_go_down = ladder_above_or_below(tile_masks, i, Ninja::VerticalDirection::DOWN);
+
+				if (can_go_up && can_go_down) {
+					// If we can go either way, pick one at random
+					climbing_state[i] = std::rand() % 2 ? Ninja::ClimbingState::UP : Ninja::ClimbingState::DOWN;
+				}
+				else if (can_go_up) {
+					// Only way is up
+					climbing_state[i] = Ninja::ClimbingState::UP;
+				}
+				else if (can_go_down) {
+					// Only way is down
+					climbing_state[i] = Ninja::ClimbingState::DOWN;
+				}
+
+				if (climbing_state[i] != Ninja::ClimbingState::NONE) {
+					// We've now decided to climb
+					ai_state[i] = AIState::CLIMBING;
+
+					flags[i] &= ~CLIMB_NEXT_LADDER;
+				}
+			}
+		}
+		else {
+			// Keep "re-rolling" while we can't climb
+
+			// Decide if we should climb the next ladder we find
+			if (random_bool(Constants::Enemy::CLIMB_NEXT_LADDER_CHANCE)) {
+				flags[i] |= CLIMB_NEXT_LADDER;
+			}
+			else {
+				flags[i] &= ~CLIMB_NEXT_LADDER;
+			}
+		}
+	}
+}
+
+void Enemies::move(number_t dt) {
+	// This does the same as Ninja::move, but without any branches, so that the compiler can vectorise it
+	// Pointers are used so that the compiler doesn't need to go through the vectors each time
+	number_t* x = position_x.data();
+	number_t* y = position_y.data();
+	number_t* vx = velocity_x.data();
+	number_t* vy = velocity_y.data();
+	const Ninja::ClimbingState* climbing = climbing_state.data();
+
+#ifdef ENEMY_LOD
+	const number_t* step = steps.data();
+	number_t* px = previous_x.data();
+	number_t* py = previous_y.data();
+#endif
+
+	number_t min_x = -Constants::Ninja::BORDER;
+	number_t max_x = Constants::GAME_WIDTH - Constants::Ninja::BORDER - Constants::Ninja::WIDTH;
+
+#ifndef ENEMY_LOD
+	// Remember where the enemies were before this update, so that they can be drawn part way between the two positions
+	previous_x = position_x;
+	previous_y = position_y;
+#endif
+
+	uint32_t enemy_count = count();
+
+	for (uint32_t i = 0; i < enemy_count; i++) {
+#ifdef ENEMY_LOD
+		// Each enemy moves by its own step, which is 0 for far-away enemies which are skipping this tick
+		number_t enemy_dt = step[i];
+
+		// Remember where the enemy was before this step, so that it can be drawn part way along it
+		// Enemies which are skipping this tick keep the position from before their last step, rather than standing still and then jumping a whole step at once
+		px[i] = enemy_dt != 0 ? x[i] : px[i];
+		py[i] = enemy_dt != 0 ? y[i] : py[i];
+#else
+		number_t enemy_dt = dt;
+#endif
+
+		// Gravity only applies if the enemy isn't climbing a ladder
+		vy[i] += climbing[i] == Ninja::ClimbingState::NONE ? Constants::Environment::GRAVITY_ACCELERATION * enemy_dt : number_t(0);
+
+		x[i] += vx[i] * enemy_dt;
+		y[i] += vy[i] * enemy_dt;
+
+		// Don't allow enemies to go off the sides
+		x[i] = std::min(std::max(x[i], min_x), max_x);
+	}
+}
+
+void Enemies::handle_collisions(TileMasks& tile_masks) {
+	for (uint32_t i = 0; i < count(); i++) {
+#ifdef ENEMY_LOD
+		// Enemies which didn't move this tick can't have hit anything new
+		if (steps[i] == 0) {
+			continue;
+		}
+#endif
+
+		// Copy the enemy into the collider, resolve its collisions, then copy it back
+		collider.position_x = position_x[i];
+		collider.position_y = position_y[i];
+		collider.previous_x = previous_x[i];
+		collider.previous_y = previous_y[i];
+		collider.velocity_x = velocity_x[i];
+		collider.velocity_y = velocity_y[i];
+		collider.climbing_state = climbing_state[i];
+		collider.can_jump = false;
+
+		collider.handle_collisions<Ninja>(tile_masks);
+
+		position_x[i] = collider.position_x;
+		position_y[i] = collider.position_y;
+		velocity_x[i] = collider.velocity_x;
+		velocity_y[i] = collider.velocity_y;
+		climbing_state[i] = collider.climbing_state;
+
+		uint8_t enemy_flags = flags[i] & ~CAN_CLIMB;
+
+		if (collider.can_climb) {
+			enemy_flags |= CAN_CLIMB;
+		}
+
+		// Update direction the enemy is facing (only if the enemy is moving)
+		if (velocity_x[i] < 0) {
+			enemy_flags |= FACING_LEFT;
+		}
+		else if (velocity_x[i] > 0) {
+			enemy_flags &= ~FACING_LEFT;
+		}
+
+		flags[i] = enemy_flags;
+
+		// If we're no longer in a climbing state, switch back to patrolling
+		// This will happen when the enemy reaches the bottom of a ladder, or if they fall off the ladder
+		if (climbing_state[i] == Ninja::ClimbingState::NONE) {
+			ai_state[i] = AIState::PATROLLING;
+		}
+	}
+}
+
+void Enemies::render(RenderQueue& render_queue, number_t interpolation) {
+	for (uint32_t i = 0; i < count(); i++) {
+		// If the enemy is travelling left, flip the image horizontally
+		SpriteTransform transform = flags[i] & FACING_LEFT ? SpriteTransform::HORIZONTAL : SpriteTransform::NONE;
+
+		uint8_t index = Constants::Sprites::RED_OFFSET + (climbing_state[i] == Ninja::ClimbingState::NONE ? Constants::Sprites::PLAYER_IDLE : Constants::Sprites::PLAYER_CLIMBING_IDLE);
+
+		Rect render_rect = get_render_rect(i, interpolation);
+
+		render_queue.add(RenderQueue::Layer::ENEMIES, index, render_rect.tl(), transform);
+
+		// Remember where the enemy was drawn, so that this area can be cleared next frame
+		last_render_rects[i] = render_rect;
+	}
+}
+
+bool Enemies::check_colliding(Ninja& ninja) {
+	number_t ninja_x = ninja.get_x();
+	number_t ninja_y = ninja.get_y();
+
+	// The grid stores the top-left corners of the enemy sprites, and finds any which could be overlapping the ninja's hitbox
+	return grid.query(ninja_x + Constants::Ninja::BORDER, ninja_y, ninja_x + Constants::SPRITE_SIZE - Constants::Ninja::BORDER, ninja_y + Constants::SPRITE_SIZE, [&](uint32_t i) {
+		narrow_phase_tests++;
+
+		return position_x[i] + Constants::SPRITE_SIZE - Constants::Ninja::BORDER > ninja_x + Constants::Ninja::BORDER &&
+			position_x[i] + Constants::Ninja::BORDER < ninja_x + Constants::SPRITE_SIZE - Constants::Ninja::BORDER &&
+			position_y[i] + Constants::SPRITE_SIZE > ninja_y &&
+			position_y[i] < ninja_y + Constants::SPRITE_SIZE;
+	});
+}
+
+uint32_t Enemies::take_narrow_phase_tests() {
+	uint32_t tests = narrow_phase_tests;
+	narrow_phase_tests = 0;
+
+	return tests;
+}
+
+Rect Enemies::get_render_rect(uint32_t index, number_t interpolation) {
+#ifdef ENEMY_LOD
+	// An enemy's step can cover several ticks, so work out how far through the whole step it is
+	interpolation = std::min((number_t(ticks_since_step[index]) + interpolation) / step_ticks[index], number_t(1));
+#endif
+
+	number_t x = previous_x[index] + (position_x[index] - previous_x[index]) * interpolation;
+	number_t y = previous_y[index] + (position_y[index] - previous_y[index]) * interpolation;
+
+	return Rect(round_to_int(x) + Constants::GAME_OFFSET_X, round_to_int(y) + Constants::GAME_OFFSET_Y, Constants::SPRITE_SIZE, Constants::SPRITE_SIZE);
+}
+
+Rect Enemies::get_last_render_rect(uint32_t index) {
+	return last_render_rects[index];
+}
+
+#ifdef BENCHMARK_ENEMIES
+void Enemies::benchmark_update() {
+	const uint32_t ENEMY_COUNTS[] = { 100, 1000, 4000 };
+	const uint16_t TICKS = Constants::Simulation::TICK_RATE;
+
+	for (uint8_t i = 0; i < Constants::LEVEL_COUNT; i++) {
+		TileMasks tile_masks(Constants::LEVELS[i]);
+
+		for (uint32_t enemy_count : ENEMY_COUNTS) {
+			Enemies enemies;
+			enemies.fill(Constants::LEVELS[i], enemy_count);
+
+			// Simulate one second of the game
+			uint32_t start_time = now_us();
+
+			for (uint16_t j = 0; j < TICKS; j++) {
+				enemies.update(Constants::Simulation::TICK_DURATION, tile_masks);
+			}
+
+			uint32_t time = us_diff(start_time, now_us());
+
+			debugf("Level %d, %lu enemies: %lu us per tick, %lu ns per enemy\n", i + 1, static_cast<unsigned long>(enemy_count),
+				static_cast<unsigned long>(time / TICKS), static_cast<unsigned long>(static_cast<uint64_t>(time) * 1000 / (static_cast<uint64_t>(TICKS) * enemy_count)));
+
+			// Check a player standing on each tile against the enemies, to see how many of them the grid lets check_colliding skip
+			const uint16_t CHECKS = Constants::GAME_WIDTH_TILES * Constants::GAME_HEIGHT_TILES;
+
+			enemies.take_narrow_phase_tests();
+			start_time = now_us();
+
+			for (uint8_t y = 0; y < Constants::GAME_HEIGHT_TILES; y++) {
+				for (uint8_t x = 0; x < Constants::GAME_WIDTH_TILES; x++) {
+					Ninja player(Ninja::Colour::BLUE, x * Constants::SPRITE_SIZE, y * Constants::SPRITE_SIZE);
+					enemies.check_colliding(player);
+				}
+			}
+
+			time = us_diff(start_time, now_us());
+
+			debugf("  %lu narrow-phase tests per player check, %lu ns per check\n",
+				static_cast<unsigned long>(enemies.take_narrow_phase_tests() / CHECKS), static_cast<unsigned long>(static_cast<uint64_t>(time) * 1000 / CHECKS));
+		}
+	}
+}
+#endif
+
+bool Enemies::ladder_above_or_below(TileMasks& tile_masks, uint32_t index, Ninja::VerticalDirection direction) {
+	// Get a position which would be one tile above/below the enemy
+	number_t point_x = position_x[index];
+	number_t point_y = position_y[index] + Constants::SPRITE_SIZE * static_cast<int8_t>(direction);
+
+	// Return true if the tile at that position is a ladder
+	return tile_at_position(tile_masks, TileMasks::Mask::LADDER, point_x, point_y);
+}
+
+bool Enemies::platform_ahead(TileMasks& tile_masks, uint32_t index) {
+	// Get a position which would be just in front of the enemy (and one tile below them)
+	number_t point_x = position_x[index] + Constants::SPRITE_SIZE / 2 + direction[index] * Constants::Enemy::PLATFORM_DETECTION_WIDTH / 2;
+	number_t point_y = position_y[index] + Constants::SPRITE_SIZE;
+
+	// Return true if the tile at that position is a platform
+	return tile_at_position(tile_masks, TileMasks::Mask::PLATFORM, point_x, point_y);
+}
+
+bool Enemies::tile_at_position(const TileMasks& tile_masks, TileMasks::Mask mask, number_t x, number_t y) {
+	// Check that the position is within the game bounds (if it isn't, there's no tile there)
+	if (x < 0 || y < 0) {
+		return false;
+	}
+
+	// Get grid position of tile (has returns false if this is past the right or bottom of the game area)
+	return tile_masks.has(mask, to_int(x / Constants::SPRITE_SIZE), to_int(y / Constants::SPRITE_SIZE));
+}
+
+bool Enemies::random_bool(number_t probability) {
+	return random_fraction() < probability;
+}
+
+number_t Enemies::random_fraction() {
+#ifdef FIXED_POINT_PHYSICS
+#if RAND_MAX >= 0xffff
+	// The random bits can be used as the fraction directly, which avoids a division
+	return Fixed::from_raw(std::rand() & (Fixed::ONE - 1));
+#else
+	// rand() doesn't return enough bits for the whole fraction (RAND_MAX is only 32767 with MSVC), so it's scaled up instead
+	return Fixed::from_raw(static_cast<int32_t>(static_cast<int64_t>(std::rand()) * Fixed::ONE / (static_cast<int64_t>(RAND_MAX) + 1)));
+#endif
+#else
+	return std::rand() / static_cast<float>(RAND_MAX);
+#endif
+}
@@ -0,0 +1,134 @@
+#include "hud.hpp"
+
+using namespace blit;
+
+// The text which is pre-rendered onto the atlas
+// The digits are followed by an extra 0, so that the spacing after the 9 can be measured
+static const char DIGITS[] = "01234567890";
+static const char* const LABELS[] = { "Level: ", "Score: " };
+
+// Memory for the atlas and strip (both are RGBA, with transparent pixels wherever there's no text)
+static uint8_t atlas_data[Constants::HUD::ATLAS_WIDTH * Constants::HUD::HEIGHT * 3 * 4];
+static uint8_t strip_data[Constants::SCREEN_WIDTH * Constants::HUD::HEIGHT * 4];
+
+Surface* Hud::atlas = nullptr;
+Surface* Hud::strip = nullptr;
+
+int32_t Hud::digit_offsets[10] = {};
+int32_t Hud::digit_advances[10] = {};
+int32_t Hud::digit_widths[10] = {};
+int32_t Hud::label_advances[2] = {};
+int32_t Hud::text_height = 0;
+
+void Hud::init() {
+    atlas = new Surface(atlas_data, PixelFormat::RGBA, Size(Constants::HUD::ATLAS_WIDTH, Constants::HUD::HEIGHT * 3));
+    strip = new Surface(strip_data, PixelFormat::RGBA, Size(Constants::SCREEN_WIDTH, Constants::HUD::HEIGHT));
+
+    text_height = screen.measure_text("0", minimal_font).h;
+
+    // Render the digits onto the first row, and each label onto its own row
+    atlas->pen = Pen(255, 255, 255);
+    atlas->text(std::string_view(DIGITS, 10), minimal_font, Point(0, 0));
+
+    for (uint8_t i = 0; i < 2; i++) {
+        atlas->text(LABELS[i], minimal_font, Point(0, Constants::HUD::HEIGHT * (i + 1)));
+
+        label_advances[i] = advance(LABELS[i], std::strlen(LABELS[i]));
+    }
+
+    // Work out where each digit ended up
+    for (uint8_t i = 0; i < 10; i++) {
+        digit_offsets[i] = advance(DIGITS, i);
+        digit_advances[i] = advance(DIGITS, i + 1) - digit_offsets[i];
+        digit_widths[i] = screen.measure_text(std::string_view(DIGITS + i, 1), minimal_font).w;
+    }
+}
+
+bool Hud::update(uint8_t _level_number, uint8_t _score) {
+    if (drawn && _level_number == level_number && _score == score) {
+        return false;
+    }
+
+    level_number = _level_number;
+    score = _score;
+    drawn = true;
+
+    redraw();
+
+    return true;
+}
+
+void Hud::render() {
+    screen.blit(strip, Rect(0, 0, Constants::SCREEN_WIDTH, Constants::HUD::HEIGHT), Point(0, 0));
+}
+
+void Hud::redraw() {
+    // Make the whole strip transparent
+    std::memset(strip_data, 0, sizeof(strip_data));
+
+    // Level number in top left corner
+    int32_t x = draw_label(Label::LEVEL, Constants::HUD::PADDING);
+    draw_number(level_number, x);
+
+    // Score in top right corner
+    x = Constants::SCREEN_WIDTH - Constants::HUD::PADDING - label_advances[static_cast<uint8_t>(Label::SCORE)] - number_width(score);
+    x = draw_label(Label::SCORE, x);
+    draw_number(score, x);
+}
+
+int32_t Hud::draw_label(Label label, int32_t x) {
+    uint8_t index = static_cast<uint8_t>(label);
+
+    strip->blit(atlas, Rect(0, Constants::HUD::HEIGHT * (index + 1), label_advances[index], text_height), Point(x, Constants::HUD::PADDING));
+
+    return x + label_advances[index];
+}
+
+int32_t Hud::draw_number(uint8_t number, int32_t x) {
+    uint8_t digits[3];
+    uint8_t count = split_digits(number, digits);
+
+    for (uint8_t i = 0; i < count; i++) {
+        uint8_t digit = digits[i];
+
+        strip->blit(atlas, Rect(digit_offsets[digit], 0, digit_advances[digit], text_height), Point(x, Constants::HUD::PADDING));
+
+        x += digit_advances[digit];
+    }
+
+    return x;
+}
+
+int32_t Hud::number_width(uint8_t number) {
+    uint8_t digits[3];
+    uint8_t count = split_digits(number, digits);
+
+    int32_t width = 0;
+
+    // There's no spacing after the last digit
+    for (uint8_t i = 0; i < count - 1; i++) {
+        width += digit_advances[digits[i]];
+    }
+
+    return width + digit_widths[digits[count - 1]];
+}
+
+int32_t Hud::advance(const char* text, uint8_t length) {
+    // There's no spacing after the last character of some text, so measure it with an extra character on the end
+    char buffer[16];
+    std::memcpy(buffer, text, length);
+    buffer[length] = '0';
+
+    return screen.measure_text(std::string_view(buffer, length + 1), minimal_font).w - screen.measure_text("0", minimal_font).w;
+}
+
+uint8_t Hud::split_digits(uint8_t number, uint8_t* digits) {
+    uint8_t count = number >= 100 ? 3 : number >= 10 ? 2 : 1;
+
+    for (uint8_t i = count; i > 0; i--) {
+        digits[i - 1] = number % 10;
+        number /= 10;
+    }
+
+    return count;
+}
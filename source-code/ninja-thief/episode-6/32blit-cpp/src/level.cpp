@@ -0,0 +1,949 @@
+#include "level.hpp"
+
+using namespace blit;
+
+Surface* Level::background = nullptr;
+Surface* Level::pipe_layer = nullptr;
+Surface* Level::static_layers = nullptr;
+
+RenderQueue Level::render_queue;
+
+uint8_t Level::pipe_layer_level = UINT8_MAX;
+
+#ifdef LEVEL_PACK
+LevelPack Level::level_pack = LevelPack::built_in();
+Constants::LevelData Level::decoded_level_data;
+#endif
+
+Level::Level() {
+
+}
+
+Level::Level(uint8_t _level_number) {
+    level_number = _level_number;
+    LevelPack::SpawnList spawns;
+
+#ifdef LEVEL_PACK
+    // Raw packs in memory are used in place, otherwise the level is decoded into decoded_level_data
+    level_data = level_pack.load(level_number, decoded_level_data, spawns);
+#else
+    level_data = &Constants::LEVELS[level_number];
+
+    // The spawn lists are worked out when the game is built, so the spawn layer doesn't need searching
+    LevelPack::load_built_in_spawns(level_number, spawns);
+#endif
+
+    // Work out which tiles the ninjas can collide with
+    tile_masks = TileMasks(*level_data);
+
+    // Create the player and enemies at the tiles in the spawn list
+    if (spawns.player != LevelPack::SpawnList::NO_SPAWN) {
+        player = PlayerNinja((spawns.player % Constants::GAME_WIDTH_TILES) * Constants::SPRITE_SIZE, (spawns.player / Constants::GAME_WIDTH_TILES) * Constants::SPRITE_SIZE);
+    }
+
+    // The number of enemies is known up front, so the enemy arrays only need allocating once
+    enemies.reserve(spawns.enemy_count);
+
+    for (uint8_t i = 0; i < spawns.enemy_count; i++) {
+        enemies.add((spawns.enemies[i] % Constants::GAME_WIDTH_TILES) * Constants::SPRITE_SIZE, (spawns.enemies[i] / Constants::GAME_WIDTH_TILES) * Constants::SPRITE_SIZE);
+    }
+
+    // Keep track of the coins and gems, so that we know when one has been collected
+    for (uint8_t y = 0; y < Constants::GAME_HEIGHT_TILES; y++) {
+        drawn_collectables[y] = tile_masks.row(TileMasks::Mask::COIN, y) | tile_masks.row(TileMasks::Mask::GEM, y);
+    }
+
+    // Drop any pipes which would be drawn over by the other layers
+    cull_hidden_pipes();
+
+#ifdef RENDER_STATS
+    report_overdraw();
+
+    uint32_t bake_start_time = now_us();
+#endif
+
+    // The pipes never change, so they only need to be blended onto the background when we move to a different level
+    if (pipe_layer_level != level_number) {
+        bake_pipe_layer();
+    }
+
+    // Nothing in the static layers changes until a collectable is picked up, so we only need to draw them once
+    bake_static_layers();
+
+#ifdef RENDER_STATS
+    debugf("Level %d layers baked in %lu us\n", level_number + 1, static_cast<unsigned long>(us_diff(bake_start_time, now_us())));
+#endif
+}
+
+void Level::init_static_layers(Surface* _background) {
+    background = _background;
+
+    // Create two surfaces the same size as the screen
+    // The pipe layer is drawn over the opaque background, so it doesn't need an alpha channel
+    pipe_layer = new Surface(new uint8_t[Constants::SCREEN_WIDTH * Constants::SCREEN_HEIGHT * 3], PixelFormat::RGB, Size(Constants::SCREEN_WIDTH, Constants::SCREEN_HEIGHT));
+    static_layers = new Surface(new uint8_t[Constants::SCREEN_WIDTH * Constants::SCREEN_HEIGHT * 4], PixelFormat::RGBA, Size(Constants::SCREEN_WIDTH, Constants::SCREEN_HEIGHT));
+
+    // Use the same spritesheet as the screen
+    pipe_layer->sprites = screen.sprites;
+    static_layers->sprites = screen.sprites;
+}
+
+#ifdef BENCHMARK_TILE_RENDERING
+void Level::benchmark_tile_rendering() {
+    const uint16_t ITERATIONS = 1000;
+
+    for (uint8_t i = 0; i < get_level_count(); i++) {
+        Level level(i);
+
+        // Time the original renderer, which draws each tile separately
+        static_layers->blit(pipe_layer, Rect(0, 0, Constants::SCREEN_WIDTH, Constants::SCREEN_HEIGHT), Point(0, 0));
+
+        uint32_t start_time = now_us();
+
+        for (uint16_t j = 0; j < ITERATIONS; j++) {
+            level.render_tiles(static_layers, level.level_data->platforms);
+            level.render_tiles(static_layers, level.level_data->extras);
+        }
+
+        uint32_t tile_time = us_diff(start_time, now_us());
+        uint32_t tile_checksum = checksum(static_layers->data, Constants::SCREEN_WIDTH * Constants::SCREEN_HEIGHT * 4);
+
+        // Time the span renderer
+        static_layers->blit(pipe_layer, Rect(0, 0, Constants::SCREEN_WIDTH, Constants::SCREEN_HEIGHT), Point(0, 0));
+
+        start_time = now_us();
+
+        for (uint16_t j = 0; j < ITERATIONS; j++) {
+            level.render_tile_spans(static_layers, level.level_data->platforms);
+            level.render_tile_spans(static_layers, level.level_data->extras);
+        }
+
+        uint32_t span_time = us_diff(start_time, now_us());
+        uint32_t span_checksum = checksum(static_layers->data, Constants::SCREEN_WIDTH * Constants::SCREEN_HEIGHT * 4);
+
+        // Time the SDK's TileMap, which draws each layer one scanline at a time
+        static_layers->blit(pipe_layer, Rect(0, 0, Constants::SCREEN_WIDTH, Constants::SCREEN_HEIGHT), Point(0, 0));
+
+        start_time = now_us();
+
+        for (uint16_t j = 0; j < ITERATIONS; j++) {
+            level.render_tile_map(static_layers, level.level_data->platforms);
+            level.render_tile_map(static_layers, level.level_data->extras);
+        }
+
+        uint32_t tile_map_time = us_diff(start_time, now_us());
+        uint32_t tile_map_checksum = checksum(static_layers->data, Constants::SCREEN_WIDTH * Constants::SCREEN_HEIGHT * 4);
+
+        debugf("Level %d: tiles %lu us, spans %lu us, tile map %lu us (per render), output %s\n", i + 1,
+            static_cast<unsigned long>(tile_time / ITERATIONS), static_cast<unsigned long>(span_time / ITERATIONS), static_cast<unsigned long>(tile_map_time / ITERATIONS),
+            tile_checksum == span_checksum && tile_checksum == tile_map_checksum ? "matches" : "DIFFERS");
+    }
+}
+#endif
+
+#ifdef BENCHMARK_STRESS
+void Level::benchmark_stress() {
+#ifdef TARGET_32BLIT_HW
+    // There's only enough RAM on the device for a few thousand enemies
+    const uint32_t ENEMY_COUNTS[] = { 10, 100, 1000 };
+#else
+    const uint32_t ENEMY_COUNTS[] = { 10, 100, 1000, 10000, 100000 };
+#endif
+    const uint16_t TICKS = Constants::Simulation::TICK_RATE;
+
+    for (uint8_t i = 0; i < get_level_count(); i++) {
+        for (uint32_t enemy_count : ENEMY_COUNTS) {
+            Level level(i);
+
+            // Replace the level's own enemies with enemy_count of them, spread over its enemy spawn positions
+            level.enemies = Enemies();
+            level.enemies.fill(*level.level_data, enemy_count);
+
+            // Simulate one second of the game
+            uint32_t start_time = now_us();
+
+            for (uint16_t j = 0; j < TICKS; j++) {
+                // Keep the level playing, so that the enemies are still updated after one of them has caught the player
+                level.level_state = LevelState::PLAYING;
+                level.update(Constants::Simulation::TICK_DURATION);
+            }
+
+            uint32_t time = std::max<uint32_t>(us_diff(start_time, now_us()), 1);
+
+            debugf("Level %d, %lu enemies: %lu ticks per second, %lu ns per enemy, %lu bytes of enemy data\n", i + 1, static_cast<unsigned long>(enemy_count),
+                static_cast<unsigned long>(static_cast<uint64_t>(TICKS) * 1000000 / time),
+                static_cast<unsigned long>(static_cast<uint64_t>(time) * 1000 / (static_cast<uint64_t>(TICKS) * enemy_count)),
+                static_cast<unsigned long>(level.enemies.get_memory_usage()));
+        }
+    }
+}
+#endif
+
+#ifdef BENCHMARK_RESTART
+void Level::benchmark_restart() {
+    const uint16_t REPEATS = 100;
+
+    for (uint8_t i = 0; i < get_level_count(); i++) {
+        Level level;
+
+        // Restart the level in the same way as the game does when the player is caught
+        uint32_t start_time = now_us();
+
+        for (uint16_t j = 0; j < REPEATS; j++) {
+            level = Level(i);
+        }
+
+        uint32_t restart_time = us_diff(start_time, now_us());
+
+        // Compare creating the enemies from the spawn list (from the pack, or the list generated when the game is built) with adding each one as the spawn layer is searched (which is how levels used to be loaded)
+        // Any change in the memory used by the enemies means their arrays were allocated again
+        LevelPack::SpawnList spawns;
+        uint32_t list_allocations = 0;
+
+        start_time = now_us();
+
+        for (uint16_t j = 0; j < REPEATS; j++) {
+#ifdef LEVEL_PACK
+            level_pack.load_spawns(i, spawns);
+#else
+            LevelPack::load_built_in_spawns(i, spawns);
+#endif
+
+            Enemies enemies;
+
+            uint32_t memory_usage = enemies.get_memory_usage();
+            enemies.reserve(spawns.enemy_count);
+            list_allocations += enemies.get_memory_usage() != memory_usage;
+
+            for (uint8_t k = 0; k < spawns.enemy_count; k++) {
+                uint32_t memory_usage = enemies.get_memory_usage();
+                enemies.add((spawns.enemies[k] % Constants::GAME_WIDTH_TILES) * Constants::SPRITE_SIZE, (spawns.enemies[k] / Constants::GAME_WIDTH_TILES) * Constants::SPRITE_SIZE);
+                list_allocations += enemies.get_memory_usage() != memory_usage;
+            }
+        }
+
+        uint32_t list_time = us_diff(start_time, now_us());
+
+        uint32_t search_allocations = 0;
+
+        start_time = now_us();
+
+        for (uint16_t j = 0; j < REPEATS; j++) {
+            Enemies enemies;
+
+            for (uint8_t k = 0; k < Constants::GAME_WIDTH_TILES * Constants::GAME_HEIGHT_TILES; k++) {
+                if (level.level_data->entity_spawns[k] == Constants::Sprites::PLAYER_IDLE + Constants::Sprites::RED_OFFSET) {
+                    uint32_t memory_usage = enemies.get_memory_usage();
+                    enemies.add((k % Constants::GAME_WIDTH_TILES) * Constants::SPRITE_SIZE, (k / Constants::GAME_WIDTH_TILES) * Constants::SPRITE_SIZE);
+                    search_allocations += enemies.get_memory_usage() != memory_usage;
+                }
+            }
+        }
+
+        uint32_t search_time = us_diff(start_time, now_us());
+
+        debugf("Level %d: %lu us to restart, creating %d enemies from the spawn list: %lu ns, %lu allocation(s), searching the spawn layer: %lu ns, %lu allocation(s)\n",
+            i + 1, static_cast<unsigned long>(restart_time / REPEATS), spawns.enemy_count,
+            static_cast<unsigned long>(static_cast<uint64_t>(list_time) * 1000 / REPEATS), static_cast<unsigned long>(list_allocations / REPEATS),
+            static_cast<unsigned long>(static_cast<uint64_t>(search_time) * 1000 / REPEATS), static_cast<unsigned long>(search_allocations / REPEATS));
+    }
+}
+#endif
+
+void Level::handle_input() {
+    player.handle_input();
+}
+
+void Level::update(number_t dt) {
+    switch (level_state) {
+    case LevelState::PLAYING:
+
+        // Update player
+        player.update(dt, tile_masks);
+
+        if (coins_left() == 0) {
+            // No more coins left, so the player has won!
+            level_state = LevelState::PLAYER_WON;
+
+            player.set_won();
+        }
+
+        // Update enemies (the ones far from the player may be updated less often)
+        enemies.set_focus(player.get_x(), player.get_y());
+        enemies.update(dt, tile_masks);
+
+        if (enemies.check_colliding(player)) {
+            // Player touched an enemy, so they're dead
+            level_state = LevelState::PLAYER_DEAD;
+
+            // Trigger "jump and fall" animation before restarting level
+            player.set_dead();
+        }
+
+        if (player.get_y() > Constants::GAME_HEIGHT) {
+            // Player has gone off the bottom of the screen, so they're dead
+            level_state = LevelState::FAILED;
+        }
+
+        break;
+
+    case LevelState::PLAYER_DEAD:
+
+        // Update player
+        player.update(dt, tile_masks);
+
+        if (player.get_y() > Constants::GAME_HEIGHT) {
+            // Player has gone off the bottom of the screen, so we can reset the level
+            level_state = LevelState::FAILED;
+        }
+
+        break;
+
+    case LevelState::PLAYER_WON:
+
+        // Update player
+        player.update(dt, tile_masks);
+
+        if (player.finished_celebrating() || player.get_y() > Constants::GAME_HEIGHT) {
+            // Player has finished doing victory jumps, or has fallen off the screen
+            level_state = LevelState::COMPLETE;
+        }
+
+        break;
+
+    default:
+        break;
+    }
+
+    // Remove any coins or gems which the player has just collected from the static layers
+    update_collectables();
+}
+
+void Level::render(number_t interpolation) {
+    pixels_drawn = 0;
+
+#ifdef COLLISION_STATS
+    // Everything counted since the last frame was rendered
+    collision_stats = Ninja::take_collision_stats();
+#endif
+
+    // Re-render the text if the level number or score has changed
+    if (hud.update(level_number + 1, player.get_score())) {
+        hud_dirty = true;
+    }
+
+#ifdef VERIFY_PIPE_LAYER
+    if (!pipe_layer_verified) {
+        verify_pipe_layer();
+        pipe_layer_verified = true;
+
+        // The check draws over the screen, so everything needs redrawing
+        full_redraw = true;
+    }
+#endif
+
+#ifdef DIRTY_RECTANGLES
+    // Each ninja needs to be erased from where it was last frame, and drawn where it is now
+    mark_dirty(player, interpolation);
+
+    for (uint32_t i = 0; i < enemies.count(); i++) {
+        mark_dirty(enemies.get_render_rect(i, interpolation), enemies.get_last_render_rect(i));
+    }
+
+    // If anything underneath the text is redrawn, the text has to be redrawn on top of it
+    Rect hud_rect(0, 0, Constants::SCREEN_WIDTH, Constants::HUD::HEIGHT);
+
+    for (uint8_t i = 0; i < dirty_rect_count; i++) {
+        if (dirty_rects[i].intersects(hud_rect)) {
+            hud_dirty = true;
+        }
+    }
+
+    if (hud_dirty) {
+        mark_dirty(hud_rect);
+    }
+
+#ifdef COLLISION_STATS
+    // The numbers change every frame, so the overlay always needs redrawing
+    mark_dirty(Rect(0, Constants::SCREEN_HEIGHT - Constants::HUD::STATS_HEIGHT, Constants::SCREEN_WIDTH, Constants::HUD::STATS_HEIGHT));
+#endif
+
+    if (!full_redraw) {
+        // Restore each changed region from the static layers
+        for (uint8_t i = 0; i < dirty_rect_count; i++) {
+            screen.blit(static_layers, dirty_rects[i], dirty_rects[i].tl());
+            pixels_drawn += dirty_rects[i].w * dirty_rects[i].h;
+        }
+    }
+#endif
+
+    if (full_redraw) {
+        // Render the background, border, pipes, water, platforms and extras all at once
+        screen.blit(static_layers, Rect(0, 0, Constants::SCREEN_WIDTH, Constants::SCREEN_HEIGHT), Point(0, 0));
+        pixels_drawn += Constants::SCREEN_WIDTH * Constants::SCREEN_HEIGHT;
+
+        hud_dirty = true;
+    }
+
+    // Queue up the enemies and player (the player is on a higher layer, so it is drawn on top)
+    enemies.render(render_queue, interpolation);
+
+    player.render(render_queue, RenderQueue::Layer::PLAYER, interpolation);
+
+    // Draw all the sprites
+    render_queue.render(&screen);
+
+    pixels_drawn += render_queue.get_draw_calls() * Constants::SPRITE_SIZE * Constants::SPRITE_SIZE;
+
+    // Render UI text
+    if (hud_dirty) {
+        hud.render();
+
+        // Count the whole strip, since the text could touch any part of it
+        pixels_drawn += Constants::SCREEN_WIDTH * Constants::HUD::HEIGHT;
+    }
+
+#ifdef COLLISION_STATS
+    render_collision_stats();
+#endif
+
+#ifdef DIRTY_RECTANGLES
+    // Everything is now up to date
+    dirty_rect_count = 0;
+    full_redraw = false;
+    hud_dirty = false;
+#endif
+}
+
+void Level::cull_hidden_pipes() {
+    for (uint8_t i = 0; i < Constants::GAME_WIDTH_TILES * Constants::GAME_HEIGHT_TILES; i++) {
+        uint8_t extra_id = level_data->extras[i];
+
+        // Coins and gems can be collected, which would uncover the pipe, so they don't count
+        if (extra_id == Constants::Sprites::COIN || extra_id == Constants::Sprites::GEM) {
+            extra_id = Constants::Sprites::BLANK_TILE;
+        }
+
+        // The water is only drawn along the bottom row
+        uint8_t water_id = i / Constants::GAME_WIDTH_TILES == Constants::GAME_HEIGHT_TILES - 1 ? Constants::Sprites::WATER : Constants::Sprites::BLANK_TILE;
+
+        // The pipe is hidden if every pixel is covered by an opaque pixel in one of the layers above it
+        bool hidden = true;
+
+        for (uint8_t row = 0; row < Constants::SPRITE_SIZE && hidden; row++) {
+            hidden = (opaque_pixels(water_id, row) | opaque_pixels(level_data->platforms[i], row) | opaque_pixels(extra_id, row)) == 0xff;
+        }
+
+        visible_pipes[i] = hidden ? Constants::Sprites::BLANK_TILE : level_data->pipes[i];
+    }
+}
+
+#ifdef RENDER_STATS
+void Level::report_overdraw() {
+    // The overdraw ratio is the average number of times each pixel in the game area is drawn when the static layers are baked (including the background)
+    uint32_t area = Constants::GAME_WIDTH * Constants::GAME_HEIGHT;
+    uint32_t pixels_before = area;
+    uint32_t pixels_after = area;
+    uint8_t pipe_count = 0;
+    uint8_t hidden_count = 0;
+
+    for (uint8_t i = 0; i < Constants::GAME_WIDTH_TILES * Constants::GAME_HEIGHT_TILES; i++) {
+        uint8_t water_id = i / Constants::GAME_WIDTH_TILES == Constants::GAME_HEIGHT_TILES - 1 ? Constants::Sprites::WATER : Constants::Sprites::BLANK_TILE;
+
+        uint32_t covering_pixels = count_opaque_pixels(water_id) + count_opaque_pixels(level_data->platforms[i]) + count_opaque_pixels(level_data->extras[i]);
+
+        pixels_before += covering_pixels + count_opaque_pixels(level_data->pipes[i]);
+        pixels_after += covering_pixels + count_opaque_pixels(visible_pipes[i]);
+
+        if (level_data->pipes[i] != Constants::Sprites::BLANK_TILE) {
+            pipe_count++;
+
+            if (visible_pipes[i] == Constants::Sprites::BLANK_TILE) {
+                hidden_count++;
+            }
+        }
+    }
+
+    uint32_t before = pixels_before * 100 / area;
+    uint32_t after = pixels_after * 100 / area;
+
+    debugf("Level %d overdraw: %lu.%02lu before culling, %lu.%02lu after (%d of %d pipe tiles hidden)\n", level_number + 1,
+        static_cast<unsigned long>(before / 100), static_cast<unsigned long>(before % 100),
+        static_cast<unsigned long>(after / 100), static_cast<unsigned long>(after % 100),
+        hidden_count, pipe_count);
+}
+#endif
+
+uint8_t Level::opaque_pixels(uint8_t tile_id, uint8_t row) {
+    if (tile_id >= TileInfo::COUNT) {
+        return 0;
+    }
+
+    return TileInfo::ROW_MASKS[tile_id][row];
+}
+
+#ifdef RENDER_STATS
+uint8_t Level::count_opaque_pixels(uint8_t tile_id) {
+    uint8_t count = 0;
+
+    for (uint8_t row = 0; row < Constants::SPRITE_SIZE; row++) {
+        for (uint8_t mask = opaque_pixels(tile_id, row); mask; mask &= mask - 1) {
+            count++;
+        }
+    }
+
+    return count;
+}
+#endif
+
+void Level::bake_pipe_layer() {
+    // Clear the surface
+    pipe_layer->pen = Pen(0, 0, 0);
+    pipe_layer->clear();
+
+    // Draw the entire background image onto the surface at (0, 0)
+    pipe_layer->blit(background, Rect(0, 0, Constants::SCREEN_WIDTH, Constants::SCREEN_HEIGHT), Point(0, 0));
+
+    // Render background pipes
+    pipe_layer->alpha = 0x80;
+#ifdef TILEMAP_LAYERS
+    render_tile_map(pipe_layer, visible_pipes);
+#else
+    render_tiles(pipe_layer, visible_pipes);
+#endif
+    pipe_layer->alpha = 0xff;
+
+    pipe_layer_level = level_number;
+}
+
+#ifdef VERIFY_PIPE_LAYER
+void Level::verify_pipe_layer() {
+    // Draw the background and pipes directly onto the screen, in the same way as they would be drawn every frame without the pipe layer
+    // The hidden pipes are left out here too, since they're never seen in either case
+    screen.pen = Pen(0, 0, 0);
+    screen.clear();
+
+    screen.blit(background, Rect(0, 0, Constants::SCREEN_WIDTH, Constants::SCREEN_HEIGHT), Point(0, 0));
+
+    screen.alpha = 0x80;
+    render_tiles(&screen, visible_pipes);
+    screen.alpha = 0xff;
+
+    // Compare every pixel in the game area
+    uint32_t mismatches = 0;
+
+    for (uint8_t y = 0; y < Constants::GAME_HEIGHT; y++) {
+        for (uint8_t x = 0; x < Constants::GAME_WIDTH; x++) {
+            Point position(x + Constants::GAME_OFFSET_X, y + Constants::GAME_OFFSET_Y);
+
+            Pen live = screen.get_pixel(position);
+            Pen baked = pipe_layer->get_pixel(position);
+
+            if (live.r != baked.r || live.g != baked.g || live.b != baked.b) {
+                mismatches++;
+            }
+        }
+    }
+
+    debugf("Level %d pipe layer: %lu mismatched pixels\n", level_number + 1, static_cast<unsigned long>(mismatches));
+}
+#endif
+
+void Level::bake_static_layers() {
+    // Start with the background, which already has the pipes blended onto it
+    static_layers->blit(pipe_layer, Rect(0, 0, Constants::SCREEN_WIDTH, Constants::SCREEN_HEIGHT), Point(0, 0));
+
+    // Render border
+    render_border();
+
+    // Render water
+    render_water();
+
+    // Render platforms
+#ifdef TILEMAP_LAYERS
+    render_tile_map(static_layers, level_data->platforms);
+#else
+    render_tile_spans(static_layers, level_data->platforms);
+#endif
+
+    // Render extras (coins, gems and ladders)
+#ifdef TILEMAP_LAYERS
+    render_tile_map(static_layers, level_data->extras);
+#else
+    render_tile_spans(static_layers, level_data->extras);
+#endif
+}
+
+void Level::bake_tile(uint8_t x, uint8_t y) {
+    uint8_t array_position = y * Constants::GAME_WIDTH_TILES + x;
+
+    // Calculate the position of the tile on the surface
+    Point position(x * Constants::SPRITE_SIZE + Constants::GAME_OFFSET_X, y * Constants::SPRITE_SIZE + Constants::GAME_OFFSET_Y);
+
+    // Redraw each layer in the same order as bake_static_layers, but only for this tile
+    static_layers->blit(pipe_layer, Rect(position.x, position.y, Constants::SPRITE_SIZE, Constants::SPRITE_SIZE), position);
+
+    if (y == Constants::GAME_HEIGHT_TILES - 1) {
+        static_layers->sprite(Constants::Sprites::WATER, position);
+    }
+
+    if (level_data->platforms[array_position] != Constants::Sprites::BLANK_TILE) {
+        static_layers->sprite(level_data->platforms[array_position], position);
+    }
+
+    uint8_t extra_id = visible_extra(x, y);
+
+    if (extra_id != Constants::Sprites::BLANK_TILE) {
+        static_layers->sprite(extra_id, position);
+    }
+}
+
+void Level::update_collectables() {
+    for (uint8_t y = 0; y < Constants::GAME_HEIGHT_TILES; y++) {
+        // Find the coins and gems which are still drawn, but are no longer in the tile masks
+        uint16_t collected = drawn_collectables[y] & ~(tile_masks.row(TileMasks::Mask::COIN, y) | tile_masks.row(TileMasks::Mask::GEM, y));
+
+        if (!collected) {
+            continue;
+        }
+
+        drawn_collectables[y] &= ~collected;
+
+        for (uint8_t x = 0; collected >> x; x++) {
+            if ((collected >> x) & 1) {
+                // Redraw the tile without the coin or gem
+                bake_tile(x, y);
+
+#ifdef DIRTY_RECTANGLES
+                // The tile needs to be updated on the screen
+                mark_dirty(Rect(x * Constants::SPRITE_SIZE + Constants::GAME_OFFSET_X, y * Constants::SPRITE_SIZE + Constants::GAME_OFFSET_Y, Constants::SPRITE_SIZE, Constants::SPRITE_SIZE));
+#endif
+            }
+        }
+    }
+}
+
+uint8_t Level::visible_extra(uint8_t x, uint8_t y) {
+    uint8_t extra_id = level_data->extras[y * Constants::GAME_WIDTH_TILES + x];
+
+    // Coins and gems are only drawn until they are collected
+    if ((extra_id == Constants::Sprites::COIN || extra_id == Constants::Sprites::GEM) && !((drawn_collectables[y] >> x) & 1)) {
+        return Constants::Sprites::BLANK_TILE;
+    }
+
+    return extra_id;
+}
+
+#ifdef DIRTY_RECTANGLES
+void Level::mark_dirty(Rect rect) {
+    // Ignore anything which is off the screen
+    rect = rect.intersection(Rect(0, 0, Constants::SCREEN_WIDTH, Constants::SCREEN_HEIGHT));
+
+    if (rect.empty()) {
+        return;
+    }
+
+    if (dirty_rect_count == Constants::MAX_DIRTY_RECTS) {
+        // Too much has changed to keep track of, so just redraw everything
+        full_redraw = true;
+        return;
+    }
+
+    dirty_rects[dirty_rect_count++] = rect;
+}
+
+void Level::mark_dirty(Ninja& ninja, number_t interpolation) {
+    mark_dirty(ninja.get_render_rect(interpolation), ninja.get_last_render_rect());
+}
+
+void Level::mark_dirty(Rect current, Rect last) {
+    if (current.intersects(last)) {
+        // Ninjas only move a pixel or two each frame, so it's cheaper to redraw one region covering both
+        int32_t left = std::min(current.x, last.x);
+        int32_t top = std::min(current.y, last.y);
+        int32_t right = std::max(current.x + current.w, last.x + last.w);
+        int32_t bottom = std::max(current.y + current.h, last.y + last.h);
+
+        mark_dirty(Rect(left, top, right - left, bottom - top));
+    }
+    else {
+        mark_dirty(current);
+        mark_dirty(last);
+    }
+}
+#endif
+
+void Level::render_tiles(Surface* surface, const uint8_t* tile_ids) {
+    // Iterate through array of tile ids and render using the correct index in the spritesheet
+    for (uint8_t y = 0; y < Constants::GAME_HEIGHT_TILES; y++) {
+        for (uint8_t x = 0; x < Constants::GAME_WIDTH_TILES; x++) {
+
+            // Calculate tile index
+            uint8_t tile_id = tile_ids[y * Constants::GAME_WIDTH_TILES + x];
+
+            // Only render the tile if it isn't a blank tile
+            if (tile_id != Constants::Sprites::BLANK_TILE) {
+                // Offset the tiles since the 32blit version has borders on the screen
+                surface->sprite(tile_id, Point(x * Constants::SPRITE_SIZE + Constants::GAME_OFFSET_X, y * Constants::SPRITE_SIZE + Constants::GAME_OFFSET_Y));
+            }
+        }
+    }
+}
+
+void Level::render_tile_map(Surface* surface, const uint8_t* tile_ids) {
+    // TileMap finds each tile by masking its coordinates with (width - 1) and (height - 1), so both need to be powers of two
+    // The 15x15 layer is copied into a 16x16 map, with the extra column and row left blank
+    const uint8_t TILE_MAP_SIZE = 16;
+
+    uint8_t padded_tile_ids[TILE_MAP_SIZE * TILE_MAP_SIZE];
+    std::memset(padded_tile_ids, Constants::Sprites::BLANK_TILE, sizeof(padded_tile_ids));
+
+    for (uint8_t y = 0; y < Constants::GAME_HEIGHT_TILES; y++) {
+        std::memcpy(padded_tile_ids + y * TILE_MAP_SIZE, tile_ids + y * Constants::GAME_WIDTH_TILES, Constants::GAME_WIDTH_TILES);
+    }
+
+    TileMap tile_map(padded_tile_ids, nullptr, Size(TILE_MAP_SIZE, TILE_MAP_SIZE), surface->sprites);
+
+    // Blank tiles are skipped, rather than being drawn using sprite 0xff
+    tile_map.empty_tile_id = Constants::Sprites::BLANK_TILE;
+
+    // The transform converts from screen coordinates to coordinates on the tile map, so we need to move it back by the size of the border
+    tile_map.transform = Mat3::translation(Vec2(-Constants::GAME_OFFSET_X, -Constants::GAME_OFFSET_Y));
+
+    // Only draw the game area
+    tile_map.draw(surface, Rect(Constants::GAME_OFFSET_X, Constants::GAME_OFFSET_Y, Constants::GAME_WIDTH, Constants::GAME_HEIGHT));
+}
+
+void Level::render_tile_spans(Surface* surface, const uint8_t* tile_ids) {
+    for (uint8_t y = 0; y < Constants::GAME_HEIGHT_TILES; y++) {
+        const uint8_t* row = tile_ids + y * Constants::GAME_WIDTH_TILES;
+
+        uint8_t x = 0;
+
+        while (x < Constants::GAME_WIDTH_TILES) {
+            // Find how many of the same tile are next to each other
+            uint8_t count = 1;
+
+            while (x + count < Constants::GAME_WIDTH_TILES && row[x + count] == row[x]) {
+                count++;
+            }
+
+            if (row[x] != Constants::Sprites::BLANK_TILE) {
+                render_tile_span(surface, row[x], Point(x * Constants::SPRITE_SIZE + Constants::GAME_OFFSET_X, y * Constants::SPRITE_SIZE + Constants::GAME_OFFSET_Y), count);
+            }
+
+            x += count;
+        }
+    }
+}
+
+void Level::render_tile_span(Surface* surface, uint8_t tile_id, Point position, uint8_t count) {
+    // The tile types are worked out from the spritesheet when the game is built (see assets/classify-tiles.py)
+    TileInfo::Type type = tile_id < TileInfo::COUNT ? TileInfo::TYPES[tile_id] : TileInfo::BLENDED;
+
+    // There's nothing to draw if every pixel is transparent
+    if (type == TileInfo::TRANSPARENT) {
+        return;
+    }
+
+    Surface* sprites = surface->sprites;
+
+    // The fast path only works for tiles without any partially transparent pixels, from a paletted spritesheet, drawn without any transparency onto an RGBA surface
+    if (type == TileInfo::BLENDED || sprites->format != PixelFormat::P || surface->format != PixelFormat::RGBA || surface->alpha != 0xff) {
+        for (uint8_t i = 0; i < count; i++) {
+            surface->sprite(tile_id, Point(position.x + i * Constants::SPRITE_SIZE, position.y));
+        }
+
+        return;
+    }
+
+    static_assert(sizeof(Pen) == 4, "RGBA pixels must be the same size as a Pen");
+    static_assert(TileInfo::TILE_SIZE == Constants::SPRITE_SIZE, "The tile info must be generated with the same sprite size as the game uses");
+
+    uint8_t columns = sprites->bounds.w / Constants::SPRITE_SIZE;
+    Point source((tile_id % columns) * Constants::SPRITE_SIZE, (tile_id / columns) * Constants::SPRITE_SIZE);
+
+    uint16_t span_width = count * Constants::SPRITE_SIZE;
+
+    // Tiles are always inside the surface, so there's no need to clip them
+    for (uint8_t y = 0; y < Constants::SPRITE_SIZE; y++) {
+        uint8_t start = TileInfo::ROW_SPANS[tile_id][y][0];
+        uint8_t end = TileInfo::ROW_SPANS[tile_id][y][1];
+        uint8_t mask = TileInfo::ROW_MASKS[tile_id][y];
+
+        // Skip rows which are completely transparent
+        if (start == end) {
+            continue;
+        }
+
+        const uint8_t* source_row = sprites->data + (source.y + y) * sprites->bounds.w + source.x;
+        Pen* destination_row = reinterpret_cast<Pen*>(surface->data) + (position.y + y) * surface->bounds.w + position.x;
+
+        // Look up the colour of each opaque pixel in the first tile (there's no need to check the alpha, since the mask tells us which pixels are opaque)
+        for (uint8_t x = start; x < end; x++) {
+            if (mask & (1 << x)) {
+                destination_row[x] = sprites->palette[source_row[x]];
+            }
+        }
+
+        if (mask == 0xff) {
+            // The whole row is opaque, so copy the first tile along the rest of the span, doubling the amount copied each time
+            uint16_t copied = Constants::SPRITE_SIZE;
+
+            while (copied < span_width) {
+                uint16_t length = std::min<uint16_t>(copied, span_width - copied);
+
+                std::memcpy(destination_row + copied, destination_row, length * sizeof(Pen));
+
+                copied += length;
+            }
+        }
+        else if (mask == (((1 << (end - start)) - 1) << start)) {
+            // There aren't any gaps between start and end, so that part of the row can be copied to each of the other tiles
+            for (uint16_t offset = Constants::SPRITE_SIZE; offset < span_width; offset += Constants::SPRITE_SIZE) {
+                std::memcpy(destination_row + offset + start, destination_row + start, (end - start) * sizeof(Pen));
+            }
+        }
+        else {
+            // Otherwise, only copy the opaque pixels, so that whatever is underneath shows through the gaps
+            for (uint16_t offset = Constants::SPRITE_SIZE; offset < span_width; offset += Constants::SPRITE_SIZE) {
+                for (uint8_t x = start; x < end; x++) {
+                    if (mask & (1 << x)) {
+                        destination_row[offset + x] = destination_row[x];
+                    }
+                }
+            }
+        }
+    }
+}
+
+#ifdef BENCHMARK_TILE_RENDERING
+uint32_t Level::checksum(const uint8_t* data, uint32_t length) {
+    // FNV-1a hash
+    uint32_t hash = 2166136261;
+
+    for (uint32_t i = 0; i < length; i++) {
+        hash = (hash ^ data[i]) * 16777619;
+    }
+
+    return hash;
+}
+#endif
+
+void Level::render_border() {
+    // Render border (only needed for 32blit, with the wider screen)
+
+    // Each row is the same
+    for (uint8_t y = 0; y < Constants::SCREEN_HEIGHT; y += Constants::SPRITE_SIZE) {
+        // Left border:
+        uint8_t x = 0;
+
+        // BORDER_FULL sprites
+        while (x < Constants::GAME_OFFSET_X - Constants::SPRITE_SIZE) {
+            render_queue.add(RenderQueue::Layer::BORDER, Constants::Sprites::BORDER_FULL, Point(x, y));
+            x += Constants::SPRITE_SIZE;
+        }
+
+        // BORDER_LEFT sprite
+        render_queue.add(RenderQueue::Layer::BORDER, Constants::Sprites::BORDER_LEFT, Point(x, y));
+
+        // Right border:
+        x = Constants::SCREEN_WIDTH;
+
+        // BORDER_FULL sprites
+        while (x > Constants::SCREEN_WIDTH - Constants::GAME_OFFSET_X) {
+            render_queue.add(RenderQueue::Layer::BORDER, Constants::Sprites::BORDER_FULL, Point(x, y));
+            x -= Constants::SPRITE_SIZE;
+        }
+
+        // BORDER_RIGHT sprite
+        render_queue.add(RenderQueue::Layer::BORDER, Constants::Sprites::BORDER_RIGHT, Point(x, y));
+    }
+
+    // Draw the whole border in one go (any sprites which are off the edge of the screen are skipped)
+    render_queue.render(static_layers);
+}
+
+void Level::render_water() {
+    // The water is one long run of the same tile
+    render_tile_span(static_layers, Constants::Sprites::WATER, Point(Constants::GAME_OFFSET_X, Constants::GAME_OFFSET_Y + Constants::GAME_HEIGHT - Constants::SPRITE_SIZE), Constants::GAME_WIDTH_TILES);
+}
+
+bool Level::level_failed() {
+    return level_state == LevelState::FAILED;
+}
+
+bool Level::level_complete() {
+    return level_state == LevelState::COMPLETE;
+}
+
+uint8_t Level::get_level_number() {
+    return level_number;
+}
+
+uint8_t Level::get_level_count() {
+#ifdef LEVEL_PACK
+    return level_pack.get_level_count();
+#else
+    return Constants::LEVEL_COUNT;
+#endif
+}
+
+#ifdef LEVEL_PACK
+bool Level::load_level_pack(const std::string& filename) {
+    LevelPack pack;
+
+    if (!pack.open(filename)) {
+        return false;
+    }
+
+    level_pack = std::move(pack);
+
+    // Level numbers from the new pack don't match the old ones, so the pipe layer needs baking again even if the level number is the same
+    pipe_layer_level = UINT8_MAX;
+
+    return true;
+}
+#endif
+
+uint32_t Level::get_pixels_drawn() {
+    return pixels_drawn;
+}
+
+uint8_t Level::get_draw_calls() {
+    return render_queue.get_draw_calls();
+}
+
+uint32_t Level::get_dropped_sprites() {
+    return render_queue.take_dropped();
+}
+
+uint32_t Level::get_narrow_phase_tests() {
+    return enemies.take_narrow_phase_tests();
+}
+
+CollisionStats Level::get_collision_stats() {
+    return collision_stats;
+}
+
+#ifdef COLLISION_STATS
+void Level::render_collision_stats() {
+    char lines[2][32];
+
+    std::snprintf(lines[0], sizeof(lines[0]), "tiles %lu aabb %lu", static_cast<unsigned long>(collision_stats.tiles_probed), static_cast<unsigned long>(collision_stats.aabb_tests));
+    std::snprintf(lines[1], sizeof(lines[1]), "x %lu y %lu 1-way %lu", static_cast<unsigned long>(collision_stats.x_resolutions),
+        static_cast<unsigned long>(collision_stats.y_resolutions), static_cast<unsigned long>(collision_stats.one_way_passes));
+
+    screen.pen = Pen(255, 255, 255);
+
+    for (uint8_t i = 0; i < 2; i++) {
+        screen.text(lines[i], minimal_font, Point(Constants::HUD::PADDING, Constants::SCREEN_HEIGHT - Constants::HUD::STATS_HEIGHT + Constants::HUD::HEIGHT * i + Constants::HUD::PADDING));
+    }
+
+    pixels_drawn += Constants::SCREEN_WIDTH * Constants::HUD::STATS_HEIGHT;
+}
+#endif
+
+uint8_t Level::coins_left() {
+    return tile_masks.count(TileMasks::Mask::COIN);
+}
\ No newline at end of file
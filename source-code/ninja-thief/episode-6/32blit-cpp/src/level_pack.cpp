@@ -0,0 +1,323 @@
+#include "level_pack.hpp"
+
+// Generated from the levels in constants.hpp when the game is built
+#include "packed_levels.hpp"
+
+using namespace blit;
+
+LevelPack::LevelPack() {
+
+}
+
+LevelPack::LevelPack(const uint8_t* _data) {
+    data = _data;
+}
+
+bool LevelPack::open(const std::string& filename) {
+    data = nullptr;
+    header.clear();
+    level_buffer.clear();
+
+    if (!file.open(filename)) {
+        return false;
+    }
+
+    uint32_t length = file.get_length();
+
+    if (length < 2) {
+        file.close();
+        return false;
+    }
+
+    if (file.get_ptr()) {
+        // The file is already in memory, so there's no need to read it
+        data = file.get_ptr();
+    }
+    else {
+        // The level count gives the size of the rest of the header (a failed read leaves it as 0, which check_header rejects)
+        uint8_t level_count = 0;
+        file.read(0, 1, reinterpret_cast<char*>(&level_count));
+
+        header.resize(std::min(get_header_size(level_count), length));
+        file.read(0, header.size(), reinterpret_cast<char*>(header.data()));
+    }
+
+    if (!check_header(length) || !check_spawn_lists()) {
+        data = nullptr;
+        header.clear();
+        file.close();
+        return false;
+    }
+
+    return true;
+}
+
+uint8_t LevelPack::get_level_count() const {
+    if (data) {
+        return data[0];
+    }
+
+    return header.empty() ? 0 : header[0];
+}
+
+bool LevelPack::is_raw() const {
+    if (data) {
+        return data[1] & FLAG_RAW;
+    }
+
+    return !header.empty() && (header[1] & FLAG_RAW);
+}
+
+uint32_t LevelPack::get_size() const {
+    return get_offset(get_level_count());
+}
+
+uint32_t LevelPack::get_size(uint8_t level_number) const {
+    return get_offset(level_number + 1) - get_offset(level_number);
+}
+
+const Constants::LevelData* LevelPack::load(uint8_t level_number, Constants::LevelData& level_data, SpawnList& spawns) {
+    const uint8_t* level = get_level(level_number);
+    uint32_t size = get_size(level_number);
+
+    // The layers come after the spawn list
+    uint32_t spawns_size = read_spawns(level, size, spawns);
+
+    const uint8_t* layers = level + spawns_size;
+    uint32_t layers_size = size - spawns_size;
+
+    if (!is_raw()) {
+        decode(layers, layers_size, level_data);
+    }
+    else if (data && layers_size >= sizeof(Constants::LevelData)) {
+        // The level can be used straight from the pack (LevelData only contains bytes, so it doesn't need aligning)
+        return reinterpret_cast<const Constants::LevelData*>(layers);
+    }
+    else {
+        // The level was read into level_buffer from a file (or is too short to use in place), so it needs copying, and any tiles missing from a damaged pack are left blank
+        uint32_t copy_size = std::min<uint32_t>(layers_size, sizeof(Constants::LevelData));
+
+        std::memcpy(&level_data, layers, copy_size);
+        std::memset(reinterpret_cast<uint8_t*>(&level_data) + copy_size, Constants::Sprites::BLANK_TILE, sizeof(Constants::LevelData) - copy_size);
+    }
+
+    return &level_data;
+}
+
+void LevelPack::load_spawns(uint8_t level_number, SpawnList& spawns) {
+    read_spawns(get_level(level_number), get_size(level_number), spawns);
+}
+
+uint32_t LevelPack::get_memory_usage() const {
+    return header.capacity() + level_buffer.capacity();
+}
+
+void LevelPack::load_built_in_spawns(uint8_t level_number, SpawnList& spawns) {
+    read_spawns(LEVEL_SPAWNS + LEVEL_SPAWN_OFFSETS[level_number], LEVEL_SPAWN_OFFSETS[level_number + 1] - LEVEL_SPAWN_OFFSETS[level_number], spawns);
+}
+
+#if defined(LEVEL_PACK) || defined(BENCHMARK_LEVEL_PACK)
+LevelPack LevelPack::built_in() {
+    return LevelPack(PACKED_LEVELS);
+}
+#endif
+
+#ifdef BENCHMARK_LEVEL_PACK
+void LevelPack::benchmark_loading() {
+    const uint16_t REPEATS = 100;
+
+    LevelPack pack = built_in();
+    Constants::LevelData level_data;
+    SpawnList spawns;
+
+    for (uint8_t i = 0; i < pack.get_level_count(); i++) {
+        uint32_t start_time = now_us();
+
+        const Constants::LevelData* level = nullptr;
+
+        for (uint16_t j = 0; j < REPEATS; j++) {
+            level = pack.load(i, level_data, spawns);
+        }
+
+        uint32_t time = us_diff(start_time, now_us());
+
+        bool matches = i < Constants::LEVEL_COUNT && std::memcmp(level, &Constants::LEVELS[i], sizeof(Constants::LevelData)) == 0;
+
+        debugf("Level %d: %lu bytes packed, %lu ns to load (%s)\n", i + 1, static_cast<unsigned long>(pack.get_size(i)),
+            static_cast<unsigned long>(static_cast<uint64_t>(time) * 1000 / REPEATS), matches ? "matches" : "DOESN'T MATCH");
+    }
+
+    debugf("Pack: %lu bytes for %d levels (%s), instead of %lu bytes\n", static_cast<unsigned long>(pack.get_size()), pack.get_level_count(),
+        pack.is_raw() ? "raw" : "compressed", static_cast<unsigned long>(pack.get_level_count() * sizeof(Constants::LevelData)));
+
+    // The compiled-in levels are always used in place
+    debugf("Constants::LEVELS: used in place, 0 bytes of RAM\n");
+
+    pack.benchmark("Built-in pack");
+
+    // Add the built-in pack as a buffer file, in the same way that a game might add a pack which is stored in its assets
+    const char* BUFFER_FILENAME = "built-in.pack";
+    File::add_buffer_file(BUFFER_FILENAME, PACKED_LEVELS, sizeof(PACKED_LEVELS));
+
+    for (const char* filename : { BUFFER_FILENAME, Constants::LEVEL_PACK_FILENAME }) {
+        LevelPack file_pack;
+
+        uint32_t start_time = now_us();
+        bool opened = file_pack.open(filename);
+        uint32_t time = us_diff(start_time, now_us());
+
+        if (opened) {
+            debugf("%s: %d levels (%s, %s), opened in %lu us\n", filename, file_pack.get_level_count(), file_pack.is_raw() ? "raw" : "compressed",
+                file_pack.data ? "in memory" : "read from the file", static_cast<unsigned long>(time));
+
+            file_pack.benchmark(filename);
+        }
+        else {
+            debugf("%s: couldn't be opened\n", filename);
+        }
+    }
+}
+#endif
+
+uint32_t LevelPack::get_header_size(uint8_t level_count) {
+    return 2 + (level_count + 1) * 4;
+}
+
+uint32_t LevelPack::get_offset(uint8_t index) const {
+    // The offsets are read a byte at a time, because they aren't aligned
+    const uint8_t* offset = (data ? data : header.data()) + 2 + index * 4;
+
+    return offset[0] | (offset[1] << 8) | (offset[2] << 16) | (static_cast<uint32_t>(offset[3]) << 24);
+}
+
+bool LevelPack::check_header(uint32_t length) const {
+    uint8_t level_count = get_level_count();
+
+    if (level_count == 0 || length < get_header_size(level_count) || get_offset(0) != get_header_size(level_count) || get_size() > length) {
+        return false;
+    }
+
+    for (uint8_t i = 0; i < level_count; i++) {
+        if (get_offset(i + 1) < get_offset(i) || (is_raw() && get_size(i) < sizeof(Constants::LevelData) + 2)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool LevelPack::check_spawn_lists() {
+    const uint16_t TILE_COUNT = Constants::GAME_WIDTH_TILES * Constants::GAME_HEIGHT_TILES;
+
+    for (uint8_t i = 0; i < get_level_count(); i++) {
+        const uint8_t* level = get_level(i);
+        uint32_t size = get_size(i);
+
+        if (size < 2 || (level[0] >= TILE_COUNT && level[0] != SpawnList::NO_SPAWN) || level[1] > TILE_COUNT || level[1] > size - 2) {
+            return false;
+        }
+
+        for (uint8_t j = 0; j < level[1]; j++) {
+            if (level[2 + j] >= TILE_COUNT) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+const uint8_t* LevelPack::get_level(uint8_t level_number) {
+    uint32_t offset = get_offset(level_number);
+
+    if (data) {
+        return data + offset;
+    }
+
+    // Only the current level needs to be in RAM, rather than the whole pack
+    uint32_t size = get_size(level_number);
+    level_buffer.resize(size);
+
+    int32_t bytes_read = file.read(offset, size, reinterpret_cast<char*>(level_buffer.data()));
+
+    // Anything which couldn't be read is treated as blank
+    std::fill(level_buffer.begin() + std::max<int32_t>(bytes_read, 0), level_buffer.end(), Constants::Sprites::BLANK_TILE);
+
+    return level_buffer.data();
+}
+
+uint32_t LevelPack::read_spawns(const uint8_t* source, uint32_t size, SpawnList& spawns) {
+    if (size < 2) {
+        spawns.player = SpawnList::NO_SPAWN;
+        spawns.enemy_count = 0;
+
+        return size;
+    }
+
+    const uint16_t TILE_COUNT = Constants::GAME_WIDTH_TILES * Constants::GAME_HEIGHT_TILES;
+
+    // Any tiles outside the level are left out, so that a damaged pack can't place the ninjas off the grid (NO_SPAWN is also outside the level)
+    spawns.player = source[0] < TILE_COUNT ? source[0] : SpawnList::NO_SPAWN;
+    spawns.enemy_count = 0;
+
+    uint8_t enemy_count = std::min<uint32_t>({ source[1], size - 2, sizeof(spawns.enemies) });
+
+    for (uint8_t i = 0; i < enemy_count; i++) {
+        if (source[2 + i] < TILE_COUNT) {
+            spawns.enemies[spawns.enemy_count++] = source[2 + i];
+        }
+    }
+
+    return 2 + enemy_count;
+}
+
+void LevelPack::decode(const uint8_t* source, uint32_t size, Constants::LevelData& level_data) {
+    const uint16_t TILE_COUNT = Constants::GAME_WIDTH_TILES * Constants::GAME_HEIGHT_TILES;
+
+    const uint8_t* source_end = source + size;
+
+    for (uint8_t* layer : { level_data.platforms, level_data.extras, level_data.entity_spawns, level_data.pipes }) {
+        uint8_t* tile = layer;
+        uint8_t* end = layer + TILE_COUNT;
+
+        while (tile < end && source_end - source >= 2) {
+            uint8_t blank_count = std::min<uint32_t>(source[0], end - tile);
+            std::memset(tile, Constants::Sprites::BLANK_TILE, blank_count);
+            tile += blank_count;
+
+            uint8_t tile_count = std::min<uint32_t>({ source[1], static_cast<uint32_t>(end - tile), static_cast<uint32_t>(source_end - source - 2) });
+            std::memcpy(tile, source + 2, tile_count);
+            tile += tile_count;
+
+            source += 2 + tile_count;
+        }
+
+        std::memset(tile, Constants::Sprites::BLANK_TILE, end - tile);
+    }
+}
+
+#ifdef BENCHMARK_LEVEL_PACK
+void LevelPack::benchmark(const char* name) {
+    const uint16_t REPEATS = 100;
+
+    Constants::LevelData level_data;
+    SpawnList spawns;
+    bool in_place = true;
+
+    uint32_t start_time = now_us();
+
+    for (uint16_t j = 0; j < REPEATS; j++) {
+        for (uint8_t i = 0; i < get_level_count(); i++) {
+            in_place &= load(i, level_data, spawns) != &level_data;
+        }
+    }
+
+    uint32_t time = us_diff(start_time, now_us());
+
+    // The most RAM used at once is the file buffers, plus the LevelData if the levels aren't used in place
+    uint32_t memory = get_memory_usage() + (in_place ? 0 : sizeof(Constants::LevelData));
+
+    debugf("%s: %lu ns per level, %lu bytes of RAM\n", name,
+        static_cast<unsigned long>(static_cast<uint64_t>(time) * 1000 / (static_cast<uint64_t>(REPEATS) * get_level_count())), static_cast<unsigned long>(memory));
+}
+#endif
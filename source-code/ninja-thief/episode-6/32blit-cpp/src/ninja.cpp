@@ -0,0 +1,682 @@
+#include "ninja.hpp"
+#include "player_ninja.hpp"
+
+using namespace blit;
+
+#ifdef COLLISION_STATS
+CollisionStats Ninja::collision_stats;
+#endif
+
+Ninja::Ninja() {
+
+}
+
+Ninja::Ninja(Colour _colour, number_t x, number_t y) : colour(_colour), position_x(x), position_y(y), previous_x(x), previous_y(y) {
+
+}
+
+template<typename T>
+void Ninja::move(T& x, T& y, T velocity_x, T& velocity_y, bool apply_gravity, T dt) {
+	if (apply_gravity) {
+		velocity_y += number_cast<T>(Constants::Environment::GRAVITY_ACCELERATION) * dt;
+	}
+
+	x += velocity_x * dt;
+	y += velocity_y * dt;
+
+	// Don't allow ninja to go off the sides
+	if (x < -Constants::Ninja::BORDER) {
+		x = -Constants::Ninja::BORDER;
+	}
+	else if (x > Constants::GAME_WIDTH - Constants::Ninja::BORDER - Constants::Ninja::WIDTH) {
+		x = Constants::GAME_WIDTH - Constants::Ninja::BORDER - Constants::Ninja::WIDTH;
+	}
+}
+
+template<typename Derived>
+void Ninja::update_physics(number_t dt, TileMasks& tile_masks) {
+	// Remember where the ninja was before this update, so that it can be drawn part way between the two positions
+	previous_x = position_x;
+	previous_y = position_y;
+
+	// This is set to true later in the update stage, but only if the ninja is on a platform
+	can_jump = false;
+
+	// Apply gravity (but only if the ninja isn't climbing a ladder), then move the ninja
+	move(position_x, position_y, velocity_x, velocity_y, climbing_state == ClimbingState::NONE, dt);
+
+	// Detect and resolve any collisions with platforms, ladders, coins etc, only if the ninja isn't dead
+	if (!dead) {
+		handle_collisions<Derived>(tile_masks);
+	}
+
+	// Update direction the ninja is facing (only if the player is moving)
+	if (velocity_x < 0) {
+		facing_direction = HorizontalDirection::LEFT;
+	}
+	else if (velocity_x > 0) {
+		facing_direction = HorizontalDirection::RIGHT;
+	}
+}
+
+void Ninja::render(RenderQueue& render_queue, RenderQueue::Layer layer, number_t interpolation) {
+	// If ninja is travelling left, flip the image horizontally
+	SpriteTransform transform = facing_direction == HorizontalDirection::RIGHT ? SpriteTransform::NONE : SpriteTransform::HORIZONTAL;
+
+	// Set sprite index (take into account sprite offset based on colour)
+	uint8_t index = colour == Colour::RED ? Constants::Sprites::RED_OFFSET : 0;
+
+	if (climbing_state == ClimbingState::NONE) {
+		// Player isn't climbing
+		index += Constants::Sprites::PLAYER_IDLE;
+	}
+	else {
+		// Player is climbing
+		index += Constants::Sprites::PLAYER_CLIMBING_IDLE;
+	}
+
+	Rect render_rect = get_render_rect(interpolation);
+
+	render_queue.add(layer, index, render_rect.tl(), transform);
+
+	// Remember where the ninja was drawn, so that this area can be cleared next frame
+	last_render_rect = render_rect;
+}
+
+bool Ninja::check_colliding(number_t object_x, number_t object_y, uint8_t object_size) {
+	return (position_x + Constants::SPRITE_SIZE - Constants::Ninja::BORDER > object_x &&
+			position_x + Constants::Ninja::BORDER < object_x + object_size &&
+			position_y + Constants::SPRITE_SIZE > object_y &&
+			position_y < object_y + object_size);
+}
+
+bool Ninja::check_colliding(Ninja& ninja) {
+	number_t ninja_x = ninja.get_x();
+	number_t ninja_y = ninja.get_y();
+
+	return (position_x + Constants::SPRITE_SIZE - Constants::Ninja::BORDER > ninja_x + Constants::Ninja::BORDER &&
+			position_x + Constants::Ninja::BORDER < ninja_x + Constants::SPRITE_SIZE - Constants::Ninja::BORDER &&
+			position_y + Constants::SPRITE_SIZE > ninja_y &&
+			position_y < ninja_y + Constants::SPRITE_SIZE);
+}
+
+number_t Ninja::get_x() {
+	return position_x;
+}
+
+number_t Ninja::get_y() {
+	return position_y;
+}
+
+Rect Ninja::get_render_rect(number_t interpolation) {
+	number_t x = previous_x + (position_x - previous_x) * interpolation;
+	number_t y = previous_y + (position_y - previous_y) * interpolation;
+
+	return Rect(round_to_int(x) + Constants::GAME_OFFSET_X, round_to_int(y) + Constants::GAME_OFFSET_Y, Constants::SPRITE_SIZE, Constants::SPRITE_SIZE);
+}
+
+Rect Ninja::get_last_render_rect() {
+	return last_render_rect;
+}
+
+CollisionStats Ninja::take_collision_stats() {
+#ifdef COLLISION_STATS
+	CollisionStats stats = collision_stats;
+	collision_stats = CollisionStats();
+
+	return stats;
+#else
+	return CollisionStats();
+#endif
+}
+
+#ifdef VERIFY_FIXED_POINT
+void Ninja::verify_fixed_point() {
+	// Frame times to test with, in seconds
+	const float TIME_STEPS[] = { 1.0f / 120.0f, 1.0f / 60.0f, 1.0f / 30.0f, 0.05f };
+
+	// The largest difference in position (in pixels) allowed between the two trajectories
+	const float TOLERANCE = 0.125f;
+
+	for (float dt : TIME_STEPS) {
+		// Jump to the right from the bottom of the game area, and keep going until the ninja falls off the bottom of the screen
+		// This runs into the right-hand side of the game area, so the clamping is checked as well
+		float float_x = 0.0f;
+		float float_y = Constants::GAME_HEIGHT - Constants::SPRITE_SIZE;
+		float float_velocity_x = number_cast<float>(Constants::Player::MAX_SPEED);
+		float float_velocity_y = -number_cast<float>(Constants::Player::JUMP_SPEED);
+
+		Fixed fixed_x = float_x;
+		Fixed fixed_y = float_y;
+		Fixed fixed_velocity_x = number_cast<Fixed>(Constants::Player::MAX_SPEED);
+		Fixed fixed_velocity_y = -number_cast<Fixed>(Constants::Player::JUMP_SPEED);
+		Fixed fixed_dt = dt;
+
+		float largest_difference = 0.0f;
+		uint16_t steps = 0;
+		uint16_t different_pixels = 0;
+
+		while (float_y < Constants::GAME_HEIGHT + Constants::SPRITE_SIZE) {
+			move(float_x, float_y, float_velocity_x, float_velocity_y, true, dt);
+			move(fixed_x, fixed_y, fixed_velocity_x, fixed_velocity_y, true, fixed_dt);
+
+			largest_difference = std::max(largest_difference, std::max(std::abs(float_x - fixed_x.to_float()), std::abs(float_y - fixed_y.to_float())));
+
+			// Count how often the ninja would be drawn in a different place
+			if (round_to_int(float_x) != round_to_int(fixed_x) || round_to_int(float_y) != round_to_int(fixed_y)) {
+				different_pixels++;
+			}
+
+			steps++;
+		}
+
+		// Print the difference in thousandths of a pixel, to avoid printing floats
+		uint32_t difference = largest_difference * 1000.0f;
+
+		debugf("Fixed-point physics at %lu us per step: largest difference %lu.%03lu px over %d steps, %d steps drawn at a different pixel (%s)\n",
+			static_cast<unsigned long>(dt * 1000000.0f), static_cast<unsigned long>(difference / 1000), static_cast<unsigned long>(difference % 1000),
+			steps, different_pixels, largest_difference <= TOLERANCE ? "within tolerance" : "OUTSIDE TOLERANCE");
+	}
+}
+#endif
+
+template<typename Derived>
+void Ninja::handle_collisions(TileMasks& tile_masks) {
+	// Reset can_climb flag (which then gets set by handle_ladders if the ninja is near a ladder)
+	can_climb = false;
+
+	// Handle platforms, by sweeping the ninja's hitbox along the path it took during this update
+	sweep_platforms(tile_masks);
+
+	// Get position of ninja in "grid" of tiles
+	// We're relying on converting to integers to truncate and hence round down
+	uint8_t x = to_int(position_x / Constants::SPRITE_SIZE);
+	uint8_t y = to_int(position_y / Constants::SPRITE_SIZE);
+
+	// Check the four tiles which the ninja might be colliding with (the top left tile is marked by the x and y previously calculated)
+
+	// We need to check that the player is within the game area
+	// If they aren't, we don't need to worry about checking for collisions
+	if (x < Constants::GAME_WIDTH_TILES && y < Constants::GAME_HEIGHT_TILES && position_x >= -Constants::Ninja::BORDER && position_y >= -Constants::SPRITE_SIZE) {
+
+		// It's possible the ninja is near the edge of the screen and we could end up checking tiles which don't exist (off the edge of the screen)
+		// To avoid this issue, we use the ternary operator to vary the maximum x and y offsets
+		// The minimum offset is handled by the trucation, since it will round up (rather than down) if the value is negative
+		for (uint8_t y_offset = 0; y_offset < (y == Constants::GAME_HEIGHT_TILES - 1 ? 1 : 2); y_offset++) {
+
+			for (uint8_t x_offset = 0; x_offset < (x == Constants::GAME_WIDTH_TILES - 1 ? 1 : 2); x_offset++) {
+				
+				// Calculate grid position of this tile
+				uint8_t new_x = x + x_offset;
+				uint8_t new_y = y + y_offset;
+
+				// Handle ladders
+				handle_ladder(tile_masks, new_x, new_y);
+
+				// Handle scoring (this is checked at compile time, so there's no call at all for enemies)
+				if constexpr (!std::is_same_v<Derived, Ninja>) {
+					static_cast<Derived*>(this)->handle_scoring(tile_masks, new_x, new_y);
+				}
+			}
+		}
+	}
+
+	// If ninja can no longer climb, reset their climbing state
+	if (!can_climb) {
+		climbing_state = ClimbingState::NONE;
+	}
+
+	if (climbing_state != ClimbingState::NONE) {
+		// If player is on a ladder, they can jump
+		can_jump = true;
+
+		// Set velocity to 0
+		velocity_x = 0;
+		velocity_y = 0;
+
+		// Get climbing speed, depending on whether ninja is the player or an enemy
+		number_t climbing_speed = colour == Colour::BLUE ? Constants::Player::CLIMBING_SPEED : Constants::Enemy::CLIMBING_SPEED;
+
+		// If player is actually climbing the ladder, set vertical velocity to be in the right direction
+		if (climbing_state == ClimbingState::UP) {
+			velocity_y = -climbing_speed;
+		}
+		else if (climbing_state == ClimbingState::DOWN) {
+			velocity_y = climbing_speed;
+		}
+	}
+}
+
+void Ninja::handle_platform(TileMasks& tile_masks, uint8_t x, uint8_t y) {
+	COUNT_COLLISION_STAT(tiles_probed);
+
+	// Check the tile is a platform (either solid or one-way)
+	if ((tile_masks.row(TileMasks::Mask::PLATFORM, y) >> x) & 1) {
+
+		// Calculate the actual position of the tile from the grid position
+		number_t tile_x = x * Constants::SPRITE_SIZE;
+		number_t tile_y = y * Constants::SPRITE_SIZE;
+
+		COUNT_COLLISION_STAT(aabb_tests);
+
+		// Check if the ninja is colliding with the tile
+		if (check_colliding(tile_x, tile_y, Constants::SPRITE_SIZE)) {
+
+			// Check if this platform have a ladder in front of it
+			if ((tile_masks.row(TileMasks::Mask::ONE_WAY, y) >> x) & 1) {
+
+				// Check that the ninja is not on a ladder
+				if (climbing_state == ClimbingState::NONE) {
+
+					// Check that the ninja is falling downwards
+					if (velocity_y > 0) {
+
+						// Check that the ninja collided with the smaller platform hitbox
+						if (position_y + Constants::SPRITE_SIZE - tile_y < Constants::ONE_WAY_PLATFORM_TOLERANCE) {
+							COUNT_COLLISION_STAT(y_resolutions);
+
+							// Set the ninja's position so that it rests on top of the platform, and reset its vertical velocity to zero
+							position_y = tile_y - Constants::SPRITE_SIZE;
+							velocity_y = 0;
+
+							// Allow the ninja to jump again
+							can_jump = true;
+
+							return;
+						}
+					}
+				}
+
+				// The ninja is climbing, moving up, or too far through the platform to land on it, so it passes through
+				COUNT_COLLISION_STAT(one_way_passes);
+			}
+			else {
+				// Resolve collision by finding the direction with the least intersection
+				// The value of the direction variable corresponds to:
+				// 0 - left side of tile
+				// 1 - top side of tile
+				// 2 - right side of tile
+				// 3 - bottom side of tile
+				uint8_t direction = 0;
+
+				// The starting value of least_intersection is at least the maximum possible intersection
+				// The width/height of the tile is the maximum intersection possible
+				number_t least_intersection = Constants::SPRITE_SIZE;
+
+				// Left side of tile
+				number_t intersection = position_x + Constants::Ninja::WIDTH + Constants::Ninja::BORDER - tile_x;
+				if (intersection < least_intersection) {
+					direction = 0;
+					least_intersection = intersection;
+				}
+
+				// Top side of tile
+				intersection = position_y + Constants::SPRITE_SIZE - tile_y;
+				if (intersection < least_intersection) {
+					direction = 1;
+					least_intersection = intersection;
+				}
+
+				// Right side of tile
+				intersection = tile_x + Constants::SPRITE_SIZE - position_x - Constants::Ninja::BORDER;
+				if (intersection < least_intersection) {
+					direction = 2;
+					least_intersection = intersection;
+				}
+
+				// Bottom side of tile
+				intersection = tile_y + Constants::SPRITE_SIZE - position_y;
+				if (intersection < least_intersection) {
+					direction = 3;
+					least_intersection = intersection;
+				}
+
+				// Directions 0 and 2 move the ninja horizontally, and 1 and 3 move it vertically
+				if (direction % 2 == 0) {
+					COUNT_COLLISION_STAT(x_resolutions);
+				}
+				else {
+					COUNT_COLLISION_STAT(y_resolutions);
+				}
+
+				// Now resolve collision by moving the ninja in the direction of least intersection, by exactly the amount equal to the least intersection
+				switch (direction) {
+				case 0:
+					// Hit the left side of a platform
+					position_x -= least_intersection;
+					velocity_x = 0;
+
+					break;
+
+				case 1:
+					// Landed on top of a platform
+					position_y -= least_intersection;
+					velocity_y = 0;
+
+					// Allow the ninja to jump again
+					can_jump = true;
+
+					// Stop the ninja from climbing
+					climbing_state = ClimbingState::NONE;
+
+					break;
+
+				case 2:
+					// Hit the right side of a platform
+					position_x += least_intersection;
+					velocity_x = 0;
+
+					break;
+
+				case 3:
+					// Hit the underside of a platform
+					position_y += least_intersection;
+					velocity_y = 0;
+
+					break;
+
+				default:
+					break;
+				}
+			}
+		}
+	}
+}
+
+void Ninja::sweep_platforms(TileMasks& tile_masks) {
+	// How close the ninja needs to be to a tile to count as touching it
+	const number_t TOUCHING_TOLERANCE = 1.0f / 256.0f;
+
+	// The ninja has already been moved, so work out how far it went, and move it back to where it started
+	number_t move_x = position_x - previous_x;
+	number_t move_y = position_y - previous_y;
+
+	position_x = previous_x;
+	position_y = previous_y;
+
+	// If the ninja started off inside a platform (which can happen when it gets locked onto a ladder), there's no time of impact, so push it out first
+	resolve_overlapping_platforms(tile_masks);
+
+	// Each collision stops the movement along one axis, so this loop runs at most three times
+	while (move_x != 0 || move_y != 0) {
+		// The ninja's hitbox at the start of the remaining movement
+		number_t left = position_x + Constants::Ninja::BORDER;
+		number_t top = position_y;
+
+		// Find the range of tiles which the hitbox passes over, and skip any which are outside the game area
+		int32_t first_x = std::max<int32_t>(to_int(std::min(left, left + move_x) / Constants::SPRITE_SIZE), 0);
+		int32_t last_x = std::min<int32_t>(to_int(std::max(left, left + move_x) / Constants::SPRITE_SIZE) + 1, Constants::GAME_WIDTH_TILES - 1);
+		int32_t first_y = std::max<int32_t>(to_int(std::min(top, top + move_y) / Constants::SPRITE_SIZE), 0);
+		int32_t last_y = std::min<int32_t>(to_int(std::max(top, top + move_y) / Constants::SPRITE_SIZE) + 1, Constants::GAME_HEIGHT_TILES - 1);
+
+		// The earliest collision found so far, as a fraction of the remaining movement
+		number_t earliest_time = 1;
+		bool hit = false;
+		bool hit_x = false;
+		number_t contact = 0;
+
+		// Only the columns which the hitbox passes over
+		uint16_t columns = ((2 << last_x) - 1) & ~((1 << first_x) - 1);
+
+		for (int32_t y = first_y; y <= last_y; y++) {
+			uint16_t platforms = tile_masks.row(TileMasks::Mask::PLATFORM, y) & columns;
+
+			// Stop once there are no more platforms to the right (which skips rows without any platforms straight away)
+			for (int32_t x = first_x; platforms >> x; x++) {
+				if (!((platforms >> x) & 1)) {
+					continue;
+				}
+
+				COUNT_COLLISION_STAT(tiles_probed);
+				COUNT_COLLISION_STAT(aabb_tests);
+
+				number_t tile_left = x * Constants::SPRITE_SIZE;
+				number_t tile_top = y * Constants::SPRITE_SIZE;
+				number_t tile_right = tile_left + Constants::SPRITE_SIZE;
+				number_t tile_bottom = tile_top + Constants::SPRITE_SIZE;
+
+				if (left < tile_right && left + Constants::Ninja::WIDTH > tile_left && top < tile_bottom && top + Constants::SPRITE_SIZE > tile_top) {
+					// The ninja is still inside this tile (one-way platforms only push the ninja out from above), so it can't be hit
+					continue;
+				}
+
+				// Platforms with a ladder in front of them can only be landed on from above, and only when not climbing
+				bool one_way = (tile_masks.row(TileMasks::Mask::ONE_WAY, y) >> x) & 1;
+
+				if (one_way && (climbing_state != ClimbingState::NONE || move_y <= 0)) {
+					COUNT_COLLISION_STAT(one_way_passes);
+				}
+
+				if (one_way && climbing_state != ClimbingState::NONE) {
+					continue;
+				}
+
+				// Work out when the hitbox would reach the side of the tile it's moving towards (if that happens during this movement)
+				// If the hitbox still overlaps the tile along the other axis at that point, it's a collision
+				if (move_x != 0 && !one_way) {
+					number_t distance = move_x > 0 ? tile_left - (left + Constants::Ninja::WIDTH) : left - tile_right;
+
+					if (distance >= 0 && distance <= absolute(move_x)) {
+						number_t time = distance / absolute(move_x);
+						number_t top_at_time = top + move_y * time;
+
+						COUNT_COLLISION_STAT(aabb_tests);
+
+						// Touching the tile counts as overlapping it if the ninja is moving into it, so that a path going exactly through the corner isn't missed (the tolerance allows for rounding errors)
+						bool overlapping = (top_at_time < tile_bottom || (move_y < 0 && top_at_time - tile_bottom < TOUCHING_TOLERANCE)) &&
+							(top_at_time + Constants::SPRITE_SIZE > tile_top || (move_y > 0 && tile_top - (top_at_time + Constants::SPRITE_SIZE) < TOUCHING_TOLERANCE));
+
+						if (overlapping && time < earliest_time) {
+							earliest_time = time;
+							hit = true;
+							hit_x = true;
+							contact = move_x > 0 ? tile_left - Constants::Ninja::WIDTH - Constants::Ninja::BORDER : tile_right - Constants::Ninja::BORDER;
+						}
+					}
+				}
+
+				if (move_y > 0 || (move_y < 0 && !one_way)) {
+					number_t distance = move_y > 0 ? tile_top - (top + Constants::SPRITE_SIZE) : top - tile_bottom;
+
+					if (distance >= 0 && distance <= absolute(move_y)) {
+						number_t time = distance / absolute(move_y);
+						number_t left_at_time = left + move_x * time;
+
+						COUNT_COLLISION_STAT(aabb_tests);
+
+						bool overlapping = (left_at_time < tile_right || (move_x < 0 && left_at_time - tile_right < TOUCHING_TOLERANCE)) &&
+							(left_at_time + Constants::Ninja::WIDTH > tile_left || (move_x > 0 && tile_left - (left_at_time + Constants::Ninja::WIDTH) < TOUCHING_TOLERANCE));
+
+						// Landing is checked after hitting a wall, and wins if they happen at the same time, so that the ninja doesn't catch on the corners of a floor
+						if (overlapping && time <= earliest_time) {
+							earliest_time = time;
+							hit = true;
+							hit_x = false;
+							contact = move_y > 0 ? tile_top - Constants::SPRITE_SIZE : tile_bottom;
+						}
+					}
+				}
+			}
+		}
+
+		if (!hit) {
+			// Nothing is in the way, so the ninja can finish moving
+			position_x += move_x;
+			position_y += move_y;
+
+			break;
+		}
+
+		// Move the ninja up to the collision, putting it exactly against the tile so that rounding errors don't leave it slightly inside
+		// The rest of the movement along the other axis is kept, so that the ninja slides along the tile
+		if (hit_x) {
+			COUNT_COLLISION_STAT(x_resolutions);
+
+			position_x = contact;
+			position_y += move_y * earliest_time;
+
+			move_y = move_y - move_y * earliest_time;
+			move_x = 0;
+
+			// Hit the side of a platform
+			velocity_x = 0;
+		}
+		else {
+			COUNT_COLLISION_STAT(y_resolutions);
+
+			position_x += move_x * earliest_time;
+			position_y = contact;
+
+			if (move_y > 0) {
+				// Landed on top of a platform
+				can_jump = true;
+
+				// Stop the ninja from climbing (this can't happen for one-way platforms, since they're skipped while climbing)
+				climbing_state = ClimbingState::NONE;
+			}
+
+			move_x = move_x - move_x * earliest_time;
+			move_y = 0;
+
+			velocity_y = 0;
+		}
+	}
+}
+
+void Ninja::resolve_overlapping_platforms(TileMasks& tile_masks) {
+	// Check the four tiles which the ninja might be overlapping (the same as handle_collisions used to do after the ninja had moved)
+	uint8_t x = to_int(position_x / Constants::SPRITE_SIZE);
+	uint8_t y = to_int(position_y / Constants::SPRITE_SIZE);
+
+	if (x < Constants::GAME_WIDTH_TILES && y < Constants::GAME_HEIGHT_TILES && position_x >= -Constants::Ninja::BORDER && position_y >= -Constants::SPRITE_SIZE) {
+		for (uint8_t y_offset = 0; y_offset < (y == Constants::GAME_HEIGHT_TILES - 1 ? 1 : 2); y_offset++) {
+			for (uint8_t x_offset = 0; x_offset < (x == Constants::GAME_WIDTH_TILES - 1 ? 1 : 2); x_offset++) {
+				handle_platform(tile_masks, x + x_offset, y + y_offset);
+			}
+		}
+	}
+}
+
+#ifdef BENCHMARK_COLLISIONS
+void Ninja::benchmark_collisions() {
+	const uint16_t ITERATIONS = 100;
+
+	// Time steps to test with: one tick, and a slow 50 ms frame (as if the game moved the ninjas once per frame)
+	const number_t TIME_STEPS[] = { Constants::Simulation::TICK_DURATION, 0.05f };
+
+	// Velocities to test with, including falling and jumping much faster than normal, which is when the old resolver lets ninjas pass through platforms
+	const number_t SPEEDS[][2] = {
+		{ Constants::Player::MAX_SPEED, 0 },
+		{ -Constants::Player::MAX_SPEED, 0 },
+		{ 0, Constants::Player::JUMP_SPEED },
+		{ 0, -Constants::Player::JUMP_SPEED },
+		{ Constants::Player::MAX_SPEED, Constants::Player::JUMP_SPEED },
+		{ -Constants::Player::MAX_SPEED, -Constants::Player::JUMP_SPEED },
+		{ 0, Constants::Player::JUMP_SPEED * 4 },
+		{ Constants::Player::MAX_SPEED, -Constants::Player::JUMP_SPEED * 4 }
+	};
+
+	for (number_t dt : TIME_STEPS) {
+		uint32_t probe_time = 0;
+		uint32_t sweep_time = 0;
+		uint32_t cases = 0;
+		uint32_t tunnelled = 0;
+
+		for (uint8_t i = 0; i < Constants::LEVEL_COUNT; i++) {
+			TileMasks tile_masks(Constants::LEVELS[i]);
+
+			// Start a ninja in every tile which doesn't have a platform in it, moving at each of the test velocities
+			for (uint8_t y = 0; y < Constants::GAME_HEIGHT_TILES; y++) {
+				for (uint8_t x = 0; x < Constants::GAME_WIDTH_TILES; x++) {
+					if ((tile_masks.row(TileMasks::Mask::PLATFORM, y) >> x) & 1) {
+						continue;
+					}
+
+					for (const number_t* speed : SPEEDS) {
+						Ninja start(Colour::BLUE, x * Constants::SPRITE_SIZE, y * Constants::SPRITE_SIZE);
+						start.velocity_x = speed[0];
+						start.velocity_y = speed[1];
+						move(start.position_x, start.position_y, start.velocity_x, start.velocity_y, false, dt);
+
+						Ninja probe = start;
+						Ninja sweep = start;
+
+						uint32_t start_time = now_us();
+
+						for (uint16_t j = 0; j < ITERATIONS; j++) {
+							probe = start;
+							probe.resolve_overlapping_platforms(tile_masks);
+						}
+
+						probe_time += us_diff(start_time, now_us());
+						start_time = now_us();
+
+						for (uint16_t j = 0; j < ITERATIONS; j++) {
+							sweep = start;
+							sweep.sweep_platforms(tile_masks);
+						}
+
+						sweep_time += us_diff(start_time, now_us());
+
+						// If the old resolver left the ninja more than a pixel further along its path than the new one, it went through (or into) a platform
+						number_t overshoot_x = speed[0] < 0 ? sweep.position_x - probe.position_x : probe.position_x - sweep.position_x;
+						number_t overshoot_y = speed[1] < 0 ? sweep.position_y - probe.position_y : probe.position_y - sweep.position_y;
+
+						if ((speed[0] != 0 && overshoot_x > 1) || (speed[1] != 0 && overshoot_y > 1)) {
+							tunnelled++;
+						}
+
+						cases++;
+					}
+				}
+			}
+		}
+
+		debugf("Collisions at %lu us per step: probe %lu ns, sweep %lu ns (per resolve), probe passed through a platform in %lu of %lu cases\n",
+			static_cast<unsigned long>(number_cast<float>(dt) * 1000000.0f),
+			static_cast<unsigned long>(probe_time * 1000 / (cases * ITERATIONS)), static_cast<unsigned long>(sweep_time * 1000 / (cases * ITERATIONS)),
+			static_cast<unsigned long>(tunnelled), static_cast<unsigned long>(cases));
+	}
+}
+#endif
+
+void Ninja::handle_ladder(TileMasks& tile_masks, uint8_t x, uint8_t y) {
+	COUNT_COLLISION_STAT(tiles_probed);
+
+	// Check if the tile is a ladder
+	if ((tile_masks.row(TileMasks::Mask::LADDER, y) >> x) & 1) {
+
+		// Calculate the actual position of the tile from the grid position
+		number_t tile_x = x * Constants::SPRITE_SIZE;
+		number_t tile_y = y * Constants::SPRITE_SIZE;
+
+		COUNT_COLLISION_STAT(aabb_tests);
+
+		// Check if ninja is colliding with the tile
+		if (check_colliding(tile_x, tile_y, Constants::SPRITE_SIZE)) {
+
+			// Check that ninja is sufficiently close to ladder
+			if (absolute(tile_x - position_x) < Constants::Ninja::WIDTH / 2) {
+				can_climb = true;
+
+				// Check if ninja should be climbing or idling on ladder
+				if (climbing_state != ClimbingState::NONE) {
+					// Lock position to ladder
+					position_x = tile_x;
+				}
+			}
+		}
+	}
+}
+
+void Ninja::jump(number_t jump_speed) {
+    // Upwards is negative
+    velocity_y = -jump_speed;
+
+	// Reset climbing state when player jumps
+	climbing_state = ClimbingState::NONE;
+}
+
+// The templates are defined here rather than in the header, so they need to be instantiated for each class which uses them
+template void Ninja::update_physics<PlayerNinja>(number_t dt, TileMasks& tile_masks);
+template void Ninja::handle_collisions<Ninja>(TileMasks& tile_masks);
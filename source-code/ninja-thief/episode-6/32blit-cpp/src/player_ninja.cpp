@@ -0,0 +1,123 @@
+#include "player_ninja.hpp"
+
+using namespace blit;
+
+PlayerNinja::PlayerNinja() {
+
+}
+
+PlayerNinja::PlayerNinja(number_t x, number_t y) : Ninja(Colour::BLUE, x, y) {
+
+}
+
+void PlayerNinja::handle_input() {
+    // Note that we use buttons.pressed, which only contains the buttons just pressed (since the last frame)
+    if (buttons.pressed & Button::A) {
+        jump_pressed = true;
+    }
+}
+
+void PlayerNinja::update(number_t dt, TileMasks& tile_masks) {
+    // If nothing is pressed, the player shouldn't move
+    velocity_x = 0;
+
+    if (won) {
+        // Jump in celebration!
+
+        if (can_jump && celebration_jumps_remaining > 0) {
+            jump(Constants::Player::CELEBRATION_JUMP_SPEED);
+            celebration_jumps_remaining--;
+        }
+    }
+    else if (!dead) {
+        // Handle any buttons the user has pressed
+
+        // Note: "else if" isn't used, because otherwise the sprite will still move when both buttons are pressed
+        // Instead, we add/subtract the velocity, so if both are pressed, nothing happens
+        if (pressed(Button::DPAD_LEFT)) {
+            velocity_x -= Constants::Player::MAX_SPEED;
+        }
+        if (pressed(Button::DPAD_RIGHT)) {
+            velocity_x += Constants::Player::MAX_SPEED;
+        }
+
+        // Handle climbing
+        if (can_climb) {
+            bool up = pressed(Button::DPAD_UP);
+            bool down = pressed(Button::DPAD_DOWN);
+
+            if (up != down) {
+                // Only one of up and down are selected
+                climbing_state = up ? ClimbingState::UP : ClimbingState::DOWN;
+            }
+            else if (climbing_state != ClimbingState::NONE) {
+                // Player has already been climbing the ladder, and either none or both of up and down are pressed
+                climbing_state = ClimbingState::IDLE;
+            }
+        }
+
+        // Handle jumping
+        // The press was remembered by handle_input, since the button is only "just pressed" for one frame
+        if (jump_pressed) {
+            if (can_jump) {
+                jump(Constants::Player::JUMP_SPEED);
+            }
+        }
+    }
+
+    // Any jump press has now been dealt with
+    jump_pressed = false;
+
+    // Move the player and handle collisions (passing PlayerNinja so that handle_scoring is called)
+    update_physics<PlayerNinja>(dt, tile_masks);
+}
+
+void PlayerNinja::handle_scoring(TileMasks& tile_masks, uint8_t x, uint8_t y) {
+    COUNT_COLLISION_STAT(tiles_probed);
+
+    // Check the tile is a coin or gem
+    bool coin = (tile_masks.row(TileMasks::Mask::COIN, y) >> x) & 1;
+    bool gem = (tile_masks.row(TileMasks::Mask::GEM, y) >> x) & 1;
+
+    if (coin || gem) {
+
+        // Calculate the actual position of the tile from the grid position
+        number_t tile_x = x * Constants::SPRITE_SIZE;
+        number_t tile_y = y * Constants::SPRITE_SIZE;
+
+        COUNT_COLLISION_STAT(aabb_tests);
+
+        // Check if the ninja is colliding with the tile
+        // We use a smaller object_size since the coins and gems are smaller, which also means we have to offset the tile_position
+        if (check_colliding(tile_x + Constants::Collectable::BORDER, tile_y + Constants::Collectable::BORDER, Constants::Collectable::SIZE)) {
+
+            // Add the correct amount of score if it's a coin or gem tile
+            if (coin) {
+                score += Constants::Collectable::COIN_SCORE;
+            }
+            else if (gem) {
+                score += Constants::Collectable::GEM_SCORE;
+            }
+
+            // Remove item from the masks (the level redraws the tile when it sees the bit has gone)
+            tile_masks.clear(coin ? TileMasks::Mask::COIN : TileMasks::Mask::GEM, x, y);
+        }
+    }
+}
+
+uint8_t PlayerNinja::get_score() {
+    return score;
+}
+
+void PlayerNinja::set_dead() {
+    dead = true;
+    jump(Constants::Player::DEATH_JUMP_SPEED);
+}
+
+void PlayerNinja::set_won() {
+    won = true;
+}
+
+bool PlayerNinja::finished_celebrating() {
+    return can_jump && celebration_jumps_remaining == 0;
+}
\ No newline at end of file
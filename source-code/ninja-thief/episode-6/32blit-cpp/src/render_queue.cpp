@@ -0,0 +1,88 @@
+#include "render_queue.hpp"
+
+using namespace blit;
+
+void RenderQueue::add(Layer layer, uint8_t index, Point position, uint8_t transform, uint8_t alpha) {
+    // Sprites below the player can't use the places kept for the player
+    uint8_t limit = layer == Layer::PLAYER ? Constants::MAX_RENDER_COMMANDS : Constants::MAX_RENDER_COMMANDS - Constants::RESERVED_PLAYER_RENDER_COMMANDS;
+
+    if (command_count >= limit) {
+        dropped++;
+        return;
+    }
+
+    commands[command_count++] = Command{ layer, index, transform, alpha, position };
+}
+
+void RenderQueue::render(Surface* surface) {
+    draw_calls = 0;
+    culled = 0;
+
+    sort();
+
+    Surface* sprites = surface->sprites;
+    uint8_t columns = sprites->bounds.w / Constants::SPRITE_SIZE;
+
+    uint8_t original_alpha = surface->alpha;
+
+    Rect source;
+    int16_t looked_up_index = -1;
+
+    for (uint8_t i = 0; i < command_count; i++) {
+        const Command& command = commands[i];
+
+        // Skip anything which wouldn't be seen
+        if (!Rect(command.position.x, command.position.y, Constants::SPRITE_SIZE, Constants::SPRITE_SIZE).intersects(surface->clip)) {
+            culled++;
+            continue;
+        }
+
+        // The commands are sorted by sprite index, so we only need to find the sprite on the spritesheet when it changes
+        // This is compared with the last sprite which was looked up, rather than the previous command, since that might have been culled
+        if (command.index != looked_up_index) {
+            source = Rect((command.index % columns) * Constants::SPRITE_SIZE, (command.index / columns) * Constants::SPRITE_SIZE, Constants::SPRITE_SIZE, Constants::SPRITE_SIZE);
+
+            looked_up_index = command.index;
+        }
+
+        surface->alpha = command.alpha;
+        surface->blit(sprites, source, command.position, command.transform);
+
+        draw_calls++;
+    }
+
+    surface->alpha = original_alpha;
+
+    command_count = 0;
+}
+
+uint8_t RenderQueue::get_draw_calls() {
+    return draw_calls;
+}
+
+uint8_t RenderQueue::get_culled() {
+    return culled;
+}
+
+uint32_t RenderQueue::take_dropped() {
+    uint32_t count = dropped;
+    dropped = 0;
+
+    return count;
+}
+
+void RenderQueue::sort() {
+    for (uint8_t i = 1; i < command_count; i++) {
+        Command command = commands[i];
+
+        uint8_t j = i;
+
+        // Move the command back until the one before it should be drawn first
+        while (j > 0 && (commands[j - 1].layer > command.layer || (commands[j - 1].layer == command.layer && commands[j - 1].index > command.index))) {
+            commands[j] = commands[j - 1];
+            j--;
+        }
+
+        commands[j] = command;
+    }
+}
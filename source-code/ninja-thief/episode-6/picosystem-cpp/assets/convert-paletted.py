@@ -0,0 +1,87 @@
+#!/bin/env python3
+from PIL import Image
+import sys
+import pathlib
+
+# Run with `./convert-paletted.py paletted_assets.hpp background.png spritesheet.png`
+# This is run automatically by CMake when PALETTED_ASSETS is turned on
+OUTPUT_PATH = pathlib.Path(sys.argv[1])
+IMAGE_PATHS = [pathlib.Path(path) for path in sys.argv[2:]]
+
+
+def to_color(r, g, b, a):
+    """Converts an 8-bit RGBA colour to a PicoSystem color_t, rounding each channel up in the same way as assets.hpp."""
+    r, g, b, a = (min(15, -(-channel // 16)) for channel in (r, g, b, a))
+
+    # GGGG BBBB AAAA RRRR
+    return (g << 12) | (b << 8) | (a << 4) | r
+
+
+def convert(path):
+    """Returns the C++ definitions for an image, along with the number of bytes used by the palette and pixel data."""
+    img = Image.open(path).convert("RGBA")
+    w, h = img.size
+
+    # The palette holds each colour once, in the order it first appears
+    colors = [to_color(*pixel) for pixel in img.getdata()]
+    palette = list(dict.fromkeys(colors))
+
+    if len(palette) > 256:
+        sys.exit(f"{path.name} has {len(palette)} colours, but only 256 fit in a palette")
+
+    indices = [palette.index(color) for color in colors]
+
+    # Pack two pixels into each byte if the palette is small enough (the first pixel goes in the lower bits)
+    if len(palette) <= 16:
+        bits = 4
+        indices += [0] * (len(indices) % 2)
+        data = [indices[i] | (indices[i + 1] << 4) for i in range(0, len(indices), 2)]
+    else:
+        bits = 8
+        data = indices
+
+    name = "asset_" + path.stem
+
+    lines = [
+        f"// {path.name}: {w}x{h}, {len(palette)} colours, {bits} bits per pixel",
+        f"const uint8_t {name}_bits = {bits};",
+        "",
+        f"const color_t {name}_palette[{len(palette)}] = {{",
+        "  " + ", ".join(f"0x{color:04x}" for color in palette),
+        "};",
+        "",
+        f"const uint8_t {name}_data[{len(data)}] = {{",
+    ]
+
+    for i in range(0, len(data), 16):
+        lines.append("  " + ", ".join(f"0x{byte:02x}" for byte in data[i:i + 16]) + ",")
+
+    lines += ["};", ""]
+
+    print(f"Converted: {path.name} {w}x{h} {len(palette)} colours, {len(data) + len(palette) * 2} bytes (was {w * h * 2} bytes)")
+
+    return lines
+
+
+lines = [
+    f"// Generated by {pathlib.Path(__file__).name} - don't edit this file by hand",
+    "#pragma once",
+    "",
+    "#include \"picosystem.hpp\"",
+    "",
+    "using namespace picosystem;",
+    "",
+    "// Returns the palette index of pixel i, from pixel data with the given number of bits per pixel",
+    "inline uint8_t palette_index(const uint8_t* data, uint8_t bits, uint32_t i) {",
+    "  return bits == 4 ? (data[i / 2] >> (i % 2 * 4)) & 0x0f : data[i];",
+    "}",
+    "",
+]
+
+for path in IMAGE_PATHS:
+    lines += convert(path)
+
+with open(OUTPUT_PATH, "w") as f:
+    f.write("\n".join(lines))
+
+print(f"Written to: {OUTPUT_PATH}")
@@ -0,0 +1,2195 @@
+#pragma once
+
+#include "picosystem.hpp"
+
+using namespace picosystem;
+
+color_t asset_background[14400] = {
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8,
+  0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x45f4, 0x45f4, 0x45f4, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8, 0x87f8,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8, 0x87f8,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x87f8, 0x87f8,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x45f4,
+  0x45f4, 0x45f4, 0x45f4, 0x45f4, 0x66f5, 0x66f5, 0x66f5, 0x66f5,
+};
+
+color_t asset_spritesheet[3072] = {
+  0xacf9, 0x79f6, 0xacf9, 0xacf9, 0xacf9, 0x79f6, 0xacf9, 0xacf9,
+  0xacf9, 0x79f6, 0xacf9, 0xacf9, 0xacf9, 0x79f6, 0xacf9, 0xacf9,
+  0xacf9, 0x79f6, 0xacf9, 0xacf9, 0xacf9, 0x79f6, 0xacf9, 0xacf9,
+  0xacf9, 0x79f6, 0xacf9, 0xacf9, 0xacf9, 0x79f6, 0xacf9, 0xacf9,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x34fb, 0x34fb, 0x34fb, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x57f4, 0x57f4, 0x79f6, 0x57f4, 0x57f4, 0x57f4, 0x79f6, 0x57f4,
+  0x57f4, 0x57f4, 0x79f6, 0x57f4, 0x57f4, 0x57f4, 0x79f6, 0x57f4,
+  0x57f4, 0x57f4, 0x79f6, 0x57f4, 0x57f4, 0x57f4, 0x79f6, 0x57f4,
+  0x57f4, 0x57f4, 0x79f6, 0x57f4, 0x57f4, 0x57f4, 0x79f6, 0x57f4,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x23f2, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x57f4, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6,
+  0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6,
+  0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x57f4,
+  0x57f4, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x57f4,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x95f4, 0x95f4, 0x95f4, 0x95f4,
+  0x95f4, 0x95f4, 0x95f4, 0x95f4, 0x95f4, 0x95f4, 0x95f4, 0x95f4,
+  0x95f4, 0x95f4, 0x95f4, 0x65f3, 0x65f3, 0x65f3, 0x95f4, 0x95f4,
+  0x95f4, 0x95f4, 0x95f4, 0x95f4, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x57f4, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6,
+  0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6,
+  0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x57f4,
+  0x57f4, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x57f4,
+  0x0000, 0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x65f3, 0x65f3,
+  0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3,
+  0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3,
+  0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x95f4, 0x0000, 0x0000, 0x0000,
+  0x57f4, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6,
+  0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6,
+  0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x57f4,
+  0x57f4, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x57f4,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3,
+  0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3,
+  0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3,
+  0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x57f4, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6,
+  0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6,
+  0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x57f4,
+  0x57f4, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x57f4,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x65f3, 0x44f2, 0x44f2,
+  0x44f2, 0x44f2, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x44f2, 0x44f2,
+  0x44f2, 0x44f2, 0x44f2, 0x44f2, 0x44f2, 0x44f2, 0x44f2, 0x44f2,
+  0x44f2, 0x44f2, 0x65f3, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x57f4, 0xacf9, 0xacf9, 0x79f6, 0xacf9, 0xacf9, 0xacf9, 0x79f6,
+  0xacf9, 0xacf9, 0xacf9, 0x79f6, 0xacf9, 0xacf9, 0xacf9, 0x79f6,
+  0xacf9, 0xacf9, 0xacf9, 0x79f6, 0xacf9, 0xacf9, 0xacf9, 0x57f4,
+  0x57f4, 0xacf9, 0xacf9, 0x79f6, 0xacf9, 0xacf9, 0xacf9, 0x57f4,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x57f4, 0x57f4, 0x57f4, 0x79f6, 0x57f4, 0x57f4, 0x57f4,
+  0x79f6, 0x57f4, 0x57f4, 0x57f4, 0x79f6, 0x57f4, 0x57f4, 0x57f4,
+  0x79f6, 0x57f4, 0x57f4, 0x57f4, 0x79f6, 0x57f4, 0x57f4, 0x0000,
+  0x0000, 0x57f4, 0x57f4, 0x57f4, 0x79f6, 0x57f4, 0x57f4, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x57f4, 0x79f6, 0x79f6, 0x79f6,
+  0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6,
+  0x79f6, 0x79f6, 0x79f6, 0x57f4, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x44f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x44f8, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x57f4, 0x79f6, 0x79f6, 0x79f6,
+  0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6,
+  0x79f6, 0x79f6, 0x79f6, 0x57f4, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x44f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x44f8, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x57f4, 0x79f6, 0x79f6, 0x79f6,
+  0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6,
+  0x79f6, 0x79f6, 0x79f6, 0x57f4, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x44f8, 0x34f4, 0x34f4, 0x75fc, 0x75fc, 0x44f8, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x95f4, 0x95f4, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x95f4, 0x95f4,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x57f4, 0x79f6, 0xacf9, 0xacf9,
+  0xacf9, 0x79f6, 0xacf9, 0xacf9, 0xacf9, 0x79f6, 0xacf9, 0xacf9,
+  0xacf9, 0x79f6, 0xacf9, 0x57f4, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x44f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x34f4, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x65f3, 0x0000, 0x34fb,
+  0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3,
+  0x34fb, 0x0000, 0x65f3, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x57f4, 0x57f4, 0x79f6, 0x57f4,
+  0x57f4, 0x57f4, 0x79f6, 0x57f4, 0x57f4, 0x57f4, 0x79f6, 0x57f4,
+  0x57f4, 0x57f4, 0x79f6, 0x57f4, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x44f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x44f8, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x65f3, 0x23f2, 0x34fb,
+  0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3,
+  0x34fb, 0x23f2, 0x65f3, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x57f4, 0x79f6, 0x79f6, 0x79f6,
+  0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6,
+  0x79f6, 0x79f6, 0x79f6, 0x57f4, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x44f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x44f8, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x65f3, 0x0000, 0x34fb,
+  0x44f2, 0x44f2, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x44f2, 0x44f2,
+  0x34fb, 0x0000, 0x65f3, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x57f4, 0x79f6, 0x79f6, 0x79f6,
+  0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6,
+  0x79f6, 0x79f6, 0x79f6, 0x57f4, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x44f8, 0x34f4, 0x34f4, 0x75fc, 0x75fc, 0x44f8, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x57f4, 0x79f6, 0x79f6, 0x79f6,
+  0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6, 0x79f6,
+  0x79f6, 0x79f6, 0x79f6, 0x57f4, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x44f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x34f4, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x95f4, 0x95f4, 0x95f4, 0x95f4, 0x65f3, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x65f3, 0x95f4, 0x95f4, 0x95f4, 0x95f4,
+  0x0000, 0x0000, 0x59f2, 0x59f2, 0x59f2, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x75fc, 0x75fc, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x65f3, 0x95f4, 0x95f4,
+  0x95f4, 0x95f4, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x95f4, 0x95f4,
+  0x95f4, 0x95f4, 0x95f4, 0x95f4, 0x95f4, 0x95f4, 0x95f4, 0x95f4,
+  0x95f4, 0x95f4, 0x65f3, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x44f2, 0x65f3, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x65f3, 0x44f2, 0x65f3, 0x65f3, 0x65f3, 0x65f3,
+  0x0000, 0x59f2, 0xfff3, 0xaef0, 0xaef0, 0x59f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x75fc, 0xf7ff, 0xb4ff, 0x75fc, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3,
+  0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3,
+  0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3,
+  0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x59f2, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x65f3, 0x59f2, 0x65f3, 0x65f3, 0x65f3, 0x65f3,
+  0x0000, 0x0000, 0x59f2, 0xaef0, 0x59f2, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x75fc, 0xb4ff, 0xb4ff, 0x75fc, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x44f2, 0x65f3, 0x65f3, 0x65f3, 0x65f3,
+  0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3,
+  0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3,
+  0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000, 0x0000,
+  0x44f2, 0x44f2, 0x44f2, 0x44f2, 0x44f2, 0xaef0, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xaef0, 0x65f3, 0x44f2, 0x44f2, 0x44f2, 0x44f2,
+  0x0000, 0x0000, 0x0000, 0x59f2, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x75fc, 0x75fc, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x44f2, 0x44f2, 0x44f2, 0x44f2,
+  0x44f2, 0x44f2, 0x44f2, 0x44f2, 0x44f2, 0x44f2, 0x44f2, 0x44f2,
+  0x44f2, 0x44f2, 0x44f2, 0x44f2, 0x44f2, 0x44f2, 0x44f2, 0x44f2,
+  0x44f2, 0x44f2, 0x44f2, 0x44f2, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x59f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x59f2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x59f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x59f2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x59f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x59f2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x59f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x59f2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xaef0, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xaef0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x59f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x59f2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x59f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x59f2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x59f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x59f2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x65f3, 0x95f4, 0x95f4,
+  0x95f4, 0x95f4, 0x65f3, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x59f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x59f2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xaef0, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xaef0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3,
+  0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x59f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x59f2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x59f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x59f2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3,
+  0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xaef0, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xaef0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x59f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x59f2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x65f3, 0x44f2, 0x44f2,
+  0x44f2, 0x44f2, 0x65f3, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x59f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x59f2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x59f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x59f2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x59f2, 0x59f2, 0xaef0, 0x0000, 0x59f2, 0x59f2, 0xaef0,
+  0x59f2, 0xaef0, 0x0000, 0x59f2, 0x59f2, 0xaef0, 0x0000, 0x59f2,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x59f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x59f2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xaef0, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xaef0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x95f4, 0x65f3, 0x65f3, 0x44f2, 0x0000, 0x0000,
+  0x59f2, 0x59f2, 0x59f2, 0x59f2, 0x59f2, 0x59f2, 0x59f2, 0x59f2,
+  0x59f2, 0x59f2, 0x59f2, 0x59f2, 0x59f2, 0x59f2, 0x59f2, 0x59f2,
+  0x0000, 0x0000, 0x0000, 0x59f2, 0x59f2, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x59f2, 0x59f2, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x59f2, 0x59f2, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x59f2, 0x59f2, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x34fb, 0x34fb, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x34fb, 0x34fb, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x34fb, 0x34fb, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x34fb, 0x34fb, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x59f2, 0x59f2, 0x59f2, 0x59f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x59f2, 0x59f2, 0x59f2, 0x59f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x59f2, 0x59f2, 0x59f2, 0x59f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x59f2, 0x59f2, 0x59f2, 0x59f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x34fb, 0x34fb, 0x34fb, 0x34fb, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x34fb, 0x34fb, 0x34fb, 0x34fb, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x34fb, 0x34fb, 0x34fb, 0x34fb, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x34fb, 0x34fb, 0x34fb, 0x34fb, 0x0000, 0x0000,
+  0x0000, 0x59f2, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x59f2, 0x59f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x59f2, 0x59f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x59f2, 0x59f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x34fb, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x34fb, 0x34fb, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x34fb, 0x34fb, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x34fb, 0x34fb, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x59f2, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x59f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x59f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x59f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x34fb, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x34fb, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x34fb, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x34fb, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x0000, 0x0000, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x0000, 0x0000, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x0000, 0x0000, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x0000, 0x0000, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x0000, 0x0000, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x0000, 0x0000, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x0000, 0x0000, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x0000, 0x0000, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x0000, 0x0000, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x0000, 0x0000, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x0000, 0x0000, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x0000, 0x0000, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x59f2, 0x59f2, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x59f2, 0x59f2, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x59f2, 0x59f2, 0x0000, 0x0000, 0x0000,
+  0x59f2, 0x0000, 0x0000, 0x59f2, 0x59f2, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x34fb, 0x34fb, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x34fb, 0x34fb, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x34fb, 0x34fb, 0x0000, 0x0000, 0x0000,
+  0x34fb, 0x0000, 0x0000, 0x34fb, 0x34fb, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x59f2, 0x59f2, 0x59f2, 0x59f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x59f2, 0x59f2, 0x59f2, 0x59f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x59f2, 0x59f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x59f2, 0x59f2, 0x59f2, 0x59f2, 0x59f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x34fb, 0x34fb, 0x34fb, 0x34fb, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x34fb, 0x34fb, 0x34fb, 0x34fb, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x34fb, 0x34fb, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x34fb, 0x34fb, 0x34fb, 0x34fb, 0x34fb, 0x0000, 0x0000,
+  0x0000, 0x59f2, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x59f2, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x59f2, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x59f2, 0x0000, 0x0000,
+  0x0000, 0x34fb, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x34fb, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x34fb, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x34fb, 0x0000, 0x0000,
+  0x59f2, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x59f2, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x59f2, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x34fb, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x34fb, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x34fb, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x23f2, 0x23f2, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x0000, 0x0000, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x0000, 0x0000, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x0000, 0x0000, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x0000, 0x0000, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x0000, 0x0000, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x0000, 0x0000, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x0000, 0x0000, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x0000, 0x0000, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x23f2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x23f2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x23f2, 0x0000, 0x0000,
+};
\ No newline at end of file
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+
+// A Q16.16 fixed-point number: 16 bits for the whole part (including the sign) and 16 bits for the fraction
+// This is used for the physics if FIXED_POINT_PHYSICS is defined, so that devices without an FPU don't need to emulate floating point maths
+class Fixed {
+public:
+    static const uint8_t FRACTION_BITS = 16;
+    static const int32_t ONE = 1 << FRACTION_BITS;
+
+    constexpr Fixed() {}
+    constexpr Fixed(int32_t value) : raw(value * ONE) {}
+
+    // When used with constants, the conversion is done by the compiler, so no floating point maths happens at runtime
+    constexpr Fixed(float value) : raw(static_cast<int32_t>(value * ONE + (value < 0.0f ? -0.5f : 0.5f))) {}
+
+    static constexpr Fixed from_raw(int32_t raw) {
+        Fixed result;
+        result.raw = raw;
+        return result;
+    }
+
+    constexpr int32_t get_raw() const {
+        return raw;
+    }
+
+    // Rounds towards zero, in the same way as converting a float to an integer
+    constexpr int32_t to_int() const {
+        return raw / ONE;
+    }
+
+    // Rounds halfway cases away from zero, in the same way as std::round
+    constexpr int32_t round() const {
+        return raw < 0 ? -((-raw + ONE / 2) >> FRACTION_BITS) : (raw + ONE / 2) >> FRACTION_BITS;
+    }
+
+    constexpr float to_float() const {
+        return static_cast<float>(raw) / ONE;
+    }
+
+    constexpr Fixed operator-() const {
+        return from_raw(-raw);
+    }
+
+    constexpr Fixed& operator+=(Fixed other) {
+        raw += other.raw;
+        return *this;
+    }
+
+    constexpr Fixed& operator-=(Fixed other) {
+        raw -= other.raw;
+        return *this;
+    }
+
+    friend constexpr Fixed operator+(Fixed a, Fixed b) {
+        return from_raw(a.raw + b.raw);
+    }
+
+    friend constexpr Fixed operator-(Fixed a, Fixed b) {
+        return from_raw(a.raw - b.raw);
+    }
+
+    // The product of two fixed-point numbers has twice as many fraction bits, so it needs 64 bits before being shifted back
+    friend constexpr Fixed operator*(Fixed a, Fixed b) {
+        return from_raw(static_cast<int32_t>((static_cast<int64_t>(a.raw) * b.raw) >> FRACTION_BITS));
+    }
+
+    friend constexpr Fixed operator/(Fixed a, Fixed b) {
+        return from_raw(static_cast<int32_t>((static_cast<int64_t>(a.raw) * ONE) / b.raw));
+    }
+
+    // Multiplying or dividing by a whole number doesn't change the number of fraction bits
+    // These are templates so that they are only used for integer types (a float would otherwise be truncated to an integer)
+    template<typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
+    friend constexpr Fixed operator*(Fixed a, T b) {
+        return from_raw(a.raw * b);
+    }
+
+    template<typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
+    friend constexpr Fixed operator*(T a, Fixed b) {
+        return from_raw(a * b.raw);
+    }
+
+    template<typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
+    friend constexpr Fixed operator/(Fixed a, T b) {
+        return from_raw(a.raw / b);
+    }
+
+    friend constexpr bool operator==(Fixed a, Fixed b) { return a.raw == b.raw; }
+    friend constexpr bool operator!=(Fixed a, Fixed b) { return a.raw != b.raw; }
+    friend constexpr bool operator<(Fixed a, Fixed b) { return a.raw < b.raw; }
+    friend constexpr bool operator>(Fixed a, Fixed b) { return a.raw > b.raw; }
+    friend constexpr bool operator<=(Fixed a, Fixed b) { return a.raw <= b.raw; }
+    friend constexpr bool operator>=(Fixed a, Fixed b) { return a.raw >= b.raw; }
+
+private:
+    int32_t raw = 0;
+};
+
+// The type used for positions, velocities and any other values in the physics and collision code
+#ifdef FIXED_POINT_PHYSICS
+typedef Fixed number_t;
+#else
+typedef float number_t;
+#endif
+
+// These work with either type, so that the physics code doesn't need to know which one is being used
+
+// Rounds towards zero
+inline int32_t to_int(float value) {
+    return static_cast<int32_t>(value);
+}
+
+inline int32_t to_int(Fixed value) {
+    return value.to_int();
+}
+
+// Rounds to the nearest whole number
+inline int32_t round_to_int(float value) {
+    return static_cast<int32_t>(std::round(value));
+}
+
+inline int32_t round_to_int(Fixed value) {
+    return value.round();
+}
+
+// Converts between float and Fixed (or returns the value unchanged if it's already the right type)
+template<typename T, typename U>
+constexpr T number_cast(U value) {
+    if constexpr (std::is_same_v<U, Fixed> && !std::is_same_v<T, Fixed>) {
+        return value.to_float();
+    }
+    else {
+        return T(value);
+    }
+}
+
+inline float absolute(float value) {
+    return std::abs(value);
+}
+
+inline Fixed absolute(Fixed value) {
+    return value < Fixed() ? -value : value;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstring>
+#include <string>
+
+#include "picosystem.hpp"
+
+#include "constants.hpp"
+
+// Displays the level number and score at the top of the screen
+// The text is only re-rendered when one of the values changes, and is built from digits which are rendered once when the game starts
+class Hud {
+public:
+	// Renders the digits and labels onto the atlas
+	// This must be called once, after the screen mode has been set, but before any Hud is updated
+	static void init();
+
+	// Re-renders the strip if the level number or score is different to what is currently shown
+	// Returns true if the strip has changed
+	bool update(uint8_t _level_number, uint8_t _score);
+
+	// Draws the strip onto the screen
+	void render();
+
+private:
+	enum class Label {
+		LEVEL = 0,
+		SCORE = 1
+	};
+
+	void redraw();
+
+	// Each of these copies text from the atlas onto the strip, and returns the x position just after the text
+	static int32_t draw_label(Label label, int32_t x);
+	static int32_t draw_number(uint8_t number, int32_t x);
+
+	// Returns the width of a number when drawn using the atlas
+	static int32_t number_width(uint8_t number);
+
+	// Returns how far along the cursor moves after drawing the first length characters of text
+	static int32_t advance(const char* text, uint8_t length);
+
+	// Splits a number into its digits (most significant first), and returns how many there are
+	static uint8_t split_digits(uint8_t number, uint8_t* digits);
+
+	// The values currently drawn on the strip
+	uint8_t level_number = 0;
+	uint8_t score = 0;
+
+	// Nothing is drawn until the first update
+	bool drawn = false;
+
+	static picosystem::buffer_t* atlas;
+	static picosystem::buffer_t* strip;
+
+	// Position and width of each digit on the first row of the atlas
+	static int32_t digit_offsets[10];
+	static int32_t digit_advances[10];
+	static int32_t digit_widths[10];
+
+	// Width of each label, including the space after it
+	static int32_t label_advances[2];
+
+	static int32_t text_height;
+};
@@ -0,0 +1,211 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "picosystem.hpp"
+
+#include "player_ninja.hpp"
+#include "enemies.hpp"
+#include "hud.hpp"
+#include "render_queue.hpp"
+#include "tile_masks.hpp"
+#include "level_pack.hpp"
+#include "constants.hpp"
+
+// Generated from the spritesheet when the game is built
+#include "tile_info.hpp"
+
+class Level {
+public:
+	Level();
+	Level(uint8_t _level_number);
+
+	// Reads the buttons, which should be done once per frame (any presses are remembered until the next update)
+	void handle_input();
+
+	void update(number_t dt);
+
+	// Draws the ninjas part way between their previous and current positions, where interpolation is how far through the current tick the game is (from 0 to 1)
+	void render(number_t interpolation);
+
+	bool level_failed();
+	bool level_complete();
+
+	uint8_t get_level_number();
+
+	// Returns the number of levels which can be played (from the pack if LEVEL_PACK is defined)
+	static uint8_t get_level_count();
+
+	// Returns the number of pixels which were drawn during the last call to render
+	uint32_t get_pixels_drawn();
+
+	// Returns the number of sprites which were drawn during the last call to render
+	uint8_t get_draw_calls();
+
+	// Returns the number of sprites which couldn't be drawn since the last call, because the render queue was full
+	uint32_t get_dropped_sprites();
+
+	// Returns the number of enemies the player has been checked against exactly since the last call (the enemies' grid skips the rest)
+	uint32_t get_narrow_phase_tests();
+
+	// Returns the collision work done by every ninja in the ticks before the last call to render (all zeros unless COLLISION_STATS is defined)
+	CollisionStats get_collision_stats();
+
+	// Allocates the off-screen buffer which the static layers of each level are drawn onto
+	// The background isn't used if PALETTED_ASSETS is defined, so it can be nullptr
+	// This must be called once, after the spritesheet has been loaded, but before any levels are created
+	static void init_static_layers(picosystem::buffer_t* _background, picosystem::buffer_t* _sprites);
+
+	// Times drawing the platforms and extras of every level tile by tile, and using spans of identical tiles
+	// This is only used if BENCHMARK_TILE_RENDERING is defined
+	static void benchmark_tile_rendering();
+
+	// Fills each level with more and more enemies, and times Level::update running without rendering anything
+	// This is only used if BENCHMARK_STRESS is defined
+	static void benchmark_stress();
+
+	// Times restarting each level, and compares creating its enemies from the spawn list with searching the spawn layer for them
+	// This is only used if BENCHMARK_RESTART is defined
+	static void benchmark_restart();
+
+private:
+	// Blends the pipes onto a copy of the background, so that no alpha blending is needed after the level has loaded
+	void bake_pipe_layer();
+
+	// Works out which pipe tiles are completely hidden behind platforms, water or ladders, so that they don't need to be drawn
+	void cull_hidden_pipes();
+
+	// Prints how many times each pixel is drawn on average, with and without the hidden pipes
+	// This is only used if RENDER_STATS is defined
+	void report_overdraw();
+
+	// Returns a bitmask of the fully opaque pixels in one row of a tile (0 for blank tiles)
+	static uint8_t opaque_pixels(uint8_t tile_id, uint8_t row);
+
+	// Returns the number of fully opaque pixels in a tile
+	static uint8_t count_opaque_pixels(uint8_t tile_id);
+
+	// Copies the whole background onto a buffer the same size as the screen
+	static void draw_background(picosystem::buffer_t* dest);
+
+	// Checks that the baked pipe layer matches the result of blending the pipes directly onto the screen
+	// This is only used if VERIFY_PIPE_LAYER is defined
+	void verify_pipe_layer();
+
+	// Draws the pipe layer, water, platforms and extras onto the static layer buffer
+	void bake_static_layers();
+
+	// Redraws the static layers for a single tile (used when a coin or gem is collected)
+	void bake_tile(uint8_t x, uint8_t y);
+
+	// Checks whether any collectables have been removed since the last update, and updates the static layers if so
+	void update_collectables();
+
+	// Returns the extra tile to draw at a position, which is blank if it was a coin or gem which has been collected
+	uint8_t visible_extra(uint8_t x, uint8_t y);
+
+#ifdef DIRTY_RECTANGLES
+	// Adds an area of the screen to the list of regions which need to be restored from the static layers next frame
+	void mark_dirty(Rect rect);
+
+	// Marks both the area a ninja was last drawn at and the area it will be drawn at next
+	void mark_dirty(Ninja& ninja, number_t interpolation);
+
+	// Marks the area something was last drawn at and the area it will be drawn at next
+	void mark_dirty(Rect current, Rect last);
+#endif
+
+    void render_tiles(const uint8_t* tile_ids);
+
+	// Renders each row of tiles as runs of identical tiles, so that opaque runs can be copied in one go and transparent tiles can be skipped
+	// The current target must be dest, and the tiles must be drawn without any transparency
+	void render_tile_spans(picosystem::buffer_t* dest, const uint8_t* tile_ids);
+
+	// Renders a horizontal run of the same tile, starting at (x, y)
+	void render_tile_span(picosystem::buffer_t* dest, uint8_t tile_id, int32_t x, int32_t y, uint8_t count);
+
+	// Used to compare the output of the two tile renderers
+	static uint32_t checksum(const picosystem::color_t* data, uint32_t length);
+
+	void render_water();
+
+	// Draws the collision stats over the bottom of the screen
+	// This is only used if COLLISION_STATS is defined
+	void render_collision_stats();
+
+	uint8_t coins_left();
+	
+	// The level's layers are never changed, so they're used straight from Constants::LEVELS rather than copied
+	// If LEVEL_PACK is defined, this points into the level pack if it's raw and in memory, otherwise to decoded_level_data
+	const Constants::LevelData* level_data = nullptr;
+
+	// Which tiles are platforms, ladders, coins and gems, used by the ninjas for collisions and scoring
+	// The coin and gem masks are the only part of the level which changes: collecting one clears its bit
+	TileMasks tile_masks;
+	uint8_t level_number = 0;
+
+	PlayerNinja player;
+	Enemies enemies;
+
+	Hud hud;
+
+	// The coins and gems which are drawn on the static layers, one row per uint16_t in the same way as the tile masks
+	// Any which are no longer in the tile masks have been collected since the last update, and need to be removed from the static layers
+	uint16_t drawn_collectables[Constants::GAME_HEIGHT_TILES] = {};
+
+	// The pipe tiles which can be seen, with any hidden behind other layers replaced by blank tiles
+	uint8_t visible_pipes[Constants::GAME_WIDTH_TILES * Constants::GAME_HEIGHT_TILES] = {};
+
+	// Only one level exists at a time, so the static layers are shared between all Level objects
+	static picosystem::buffer_t* background;
+	static picosystem::buffer_t* sprites;
+	static picosystem::buffer_t* pipe_layer;
+	static picosystem::buffer_t* static_layers;
+
+	// Sprites are queued up and drawn together at the end of rendering
+	static RenderQueue render_queue;
+
+	// The level number which the pipe layer was last baked for (UINT8_MAX if it hasn't been baked yet)
+	static uint8_t pipe_layer_level;
+
+#ifdef LEVEL_PACK
+	// The pack which levels are loaded from
+	static LevelPack level_pack;
+
+	// The layers of the level most recently decoded from the pack
+	// Only one level is played at a time, so this is shared rather than stored in each Level (which also means level_data stays valid when a Level is copied)
+	static Constants::LevelData decoded_level_data;
+#endif
+
+#ifdef DIRTY_RECTANGLES
+	// Regions of the screen which have changed since the last frame
+	Rect dirty_rects[Constants::MAX_DIRTY_RECTS];
+	uint8_t dirty_rect_count = 0;
+#endif
+
+	// The whole screen needs redrawing when a level is first rendered
+	bool full_redraw = true;
+
+	// Set when the level number or score text needs to be drawn onto the screen
+	bool hud_dirty = true;
+
+	bool pipe_layer_verified = false;
+
+	// The collision work done during the ticks before the last frame
+	CollisionStats collision_stats;
+
+	uint32_t pixels_drawn = 0;
+
+	enum class LevelState {
+		PLAYING,
+		PLAYER_DEAD,
+		PLAYER_WON,
+		FAILED,
+		COMPLETE
+	};
+
+	LevelState level_state = LevelState::PLAYING;
+};
\ No newline at end of file
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <cstdio>
+
+#include "picosystem.hpp"
+
+#include "constants.hpp"
+#include "render_queue.hpp"
+#include "tile_masks.hpp"
+#include "rect.hpp"
+
+// Counts of the work done by the collision code, added up over every ninja (including the enemies)
+// These are only counted if COLLISION_STATS is defined, otherwise COUNT_COLLISION_STAT expands to nothing, so counting costs nothing
+struct CollisionStats {
+    // Tiles whose masks were checked
+    uint32_t tiles_probed = 0;
+
+    // Hitbox overlap tests, including the checks made at each time of impact found by the sweep
+    uint32_t aabb_tests = 0;
+
+    // Collisions resolved by moving the ninja horizontally or vertically
+    uint32_t x_resolutions = 0;
+    uint32_t y_resolutions = 0;
+
+    // One-way platforms which the ninja was allowed to pass through (because it was climbing, or wasn't moving down onto them)
+    uint32_t one_way_passes = 0;
+};
+
+#ifdef COLLISION_STATS
+#define COUNT_COLLISION_STAT(counter) (Ninja::collision_stats.counter++)
+#else
+#define COUNT_COLLISION_STAT(counter)
+#endif
+
+class Ninja {
+    // The enemies are stored separately, but use the same collision code
+    friend class Enemies;
+
+public:
+    enum class Colour {
+        BLUE = 0,
+        RED = 1
+    };
+
+    Ninja();
+    Ninja(Colour _colour, number_t x, number_t y);
+
+    // Queues the ninja's sprite to be drawn on the given layer
+    // The ninja is drawn between its previous and current positions, where interpolation is how far through the current tick the game is (from 0 to 1)
+    void render(RenderQueue& render_queue, RenderQueue::Layer layer, number_t interpolation);
+
+    bool check_colliding(number_t object_x, number_t object_y, uint8_t object_size);
+    bool check_colliding(Ninja& ninja);
+
+    number_t get_x();
+    number_t get_y();
+
+    // Returns the area of the screen covered by the ninja's sprite, when drawn with the interpolation provided
+    Rect get_render_rect(number_t interpolation);
+
+    // Returns the area of the screen which was covered by the ninja's sprite when it was last rendered
+    Rect get_last_render_rect();
+
+    // Simulates a jump using both float and fixed-point maths, and prints the largest difference between the two trajectories
+    // This is only used if VERIFY_FIXED_POINT is defined
+    static void verify_fixed_point();
+
+    // Times the swept collision resolver against the old one (which only checks the tiles the ninja ends up overlapping) for every level, and counts how often the old one lets a ninja pass through a platform
+    // This is only used if BENCHMARK_COLLISIONS is defined
+    static void benchmark_collisions();
+
+    // Returns the collision work done since the last call, then resets the counts
+    // The counts are always zero unless COLLISION_STATS is defined
+    static CollisionStats take_collision_stats();
+
+protected:
+    // Moves the ninja and resolves its collisions
+    // Derived is the class of the ninja being updated, so that its handle_scoring method can be called without a vtable
+    template<typename Derived>
+    void update_physics(number_t dt, TileMasks& tile_masks);
+
+    void jump(number_t jump_speed);
+
+    Colour colour;
+
+    number_t position_x = 0;
+    number_t position_y = 0;
+    number_t velocity_x = 0;
+    number_t velocity_y = 0;
+
+    // Position at the start of the last update, used to draw the ninja between ticks
+    number_t previous_x = 0;
+    number_t previous_y = 0;
+
+    enum class HorizontalDirection {
+        LEFT = -1,
+        RIGHT = 1
+    };
+
+	enum class VerticalDirection {
+		UP = -1,
+		DOWN = 1
+	};
+
+    HorizontalDirection facing_direction = HorizontalDirection::RIGHT;
+
+    bool can_jump = false;
+    bool can_climb = false;
+    
+    enum class ClimbingState {
+        NONE,
+        IDLE,
+        UP,
+        DOWN
+    };
+
+    ClimbingState climbing_state = ClimbingState::NONE;
+
+    // If a ninja is dead, they don't collide with any tiles, but are still affected by gravity
+    bool dead = false;
+
+#ifdef COLLISION_STATS
+    static CollisionStats collision_stats;
+#endif
+
+private:
+    // Applies gravity (if it's enabled), moves the ninja, and stops it from going off the sides
+    // This is a template so that verify_fixed_point can run it with both float and Fixed
+    template<typename T>
+    static void move(T& x, T& y, T velocity_x, T& velocity_y, bool apply_gravity, T dt);
+
+    // Derived::handle_scoring is called for each tile the ninja is touching
+    // The enemies use Ninja as Derived, which leaves out the scoring completely
+    template<typename Derived>
+    void handle_collisions(TileMasks& tile_masks);
+
+    // Moves the ninja from its previous position to its new one, stopping at the first platform in the way (so fast-moving ninjas can't pass through thin platforms)
+    void sweep_platforms(TileMasks& tile_masks);
+
+    // Pushes the ninja out of any platforms it's overlapping
+    void resolve_overlapping_platforms(TileMasks& tile_masks);
+
+    void handle_platform(TileMasks& tile_masks, uint8_t x, uint8_t y);
+    void handle_ladder(TileMasks& tile_masks, uint8_t x, uint8_t y);
+
+    Rect last_render_rect;
+};
\ No newline at end of file
@@ -0,0 +1,16 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+
+#include "picosystem.hpp"
+
+#include "constants.hpp"
+#include "level.hpp"
+
+#ifdef PALETTED_ASSETS
+// Generated from the images in the assets folder when the game is built
+#include "paletted_assets.hpp"
+#else
+#include "assets.hpp"
+#endif
\ No newline at end of file
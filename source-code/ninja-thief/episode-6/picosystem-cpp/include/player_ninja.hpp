@@ -0,0 +1,39 @@
+#pragma once
+
+#include "picosystem.hpp"
+
+#include "ninja.hpp"
+#include "constants.hpp"
+
+class PlayerNinja : public Ninja {
+	// Ninja calls handle_scoring during collision handling
+	friend class Ninja;
+
+public:
+	PlayerNinja();
+	PlayerNinja(number_t x, number_t y);
+
+	// Reads the buttons, which should be done once per frame
+	// The jump button is only "just pressed" for one frame, so it's remembered until the next update, in case no updates happen this frame
+	void handle_input();
+
+	void update(number_t dt, TileMasks& tile_masks);
+
+	uint8_t get_score();
+
+	void set_dead();
+	void set_won();
+
+	bool finished_celebrating();
+
+private:
+	void handle_scoring(TileMasks& tile_masks, uint8_t x, uint8_t y);
+
+	uint8_t score = 0;
+
+	bool jump_pressed = false;
+
+	bool won = false;
+
+	uint8_t celebration_jumps_remaining = Constants::Player::CELEBRATION_JUMP_COUNT;
+};
\ No newline at end of file
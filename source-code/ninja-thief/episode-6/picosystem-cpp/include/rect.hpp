@@ -0,0 +1,32 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+// PicoSystem doesn't have a rectangle type, so we use this to keep track of areas of the screen
+struct Rect {
+    int32_t x = 0;
+    int32_t y = 0;
+    int32_t w = 0;
+    int32_t h = 0;
+
+    Rect() {}
+    Rect(int32_t _x, int32_t _y, int32_t _w, int32_t _h) : x(_x), y(_y), w(_w), h(_h) {}
+
+    bool empty() const {
+        return w <= 0 || h <= 0;
+    }
+
+    bool intersects(const Rect& other) const {
+        return x < other.x + other.w && other.x < x + w && y < other.y + other.h && other.y < y + h;
+    }
+
+    Rect intersection(const Rect& other) const {
+        int32_t left = std::max(x, other.x);
+        int32_t top = std::max(y, other.y);
+        int32_t right = std::min(x + w, other.x + other.w);
+        int32_t bottom = std::min(y + h, other.y + other.h);
+
+        return Rect(left, top, right - left, bottom - top);
+    }
+};
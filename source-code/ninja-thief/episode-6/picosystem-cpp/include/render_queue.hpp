@@ -0,0 +1,56 @@
+#pragma once
+
+#include "picosystem.hpp"
+
+#include "constants.hpp"
+#include "rect.hpp"
+
+// Collects sprites to be drawn, so that they can be sorted by layer and sprite index, then drawn all at once
+// This is also where sprites which are off the buffer are skipped, and where the number of draw calls is counted
+class RenderQueue {
+public:
+	// Layers are drawn in this order, so later layers appear on top
+	enum class Layer : uint8_t {
+		BORDER,
+		ENEMIES,
+		PLAYER
+	};
+
+	// Queues a sprite to be drawn
+	// If the queue is full, the sprite is ignored and counted as dropped (the last few places in the queue can only be used by the player)
+	void add(Layer layer, uint8_t index, int32_t x, int32_t y, uint8_t flags = 0, uint8_t alpha = 0xf);
+
+	// Draws all the queued sprites onto the dest buffer, using the sprites buffer as the spritesheet, and then empties the queue
+	void render(picosystem::buffer_t* dest, picosystem::buffer_t* sprites);
+
+	// Returns the number of sprites drawn by the last call to render
+	uint8_t get_draw_calls();
+
+	// Returns the number of sprites skipped by the last call to render, because they were completely off the buffer
+	uint8_t get_culled();
+
+	// Returns the number of sprites which have been dropped because the queue was full since the last call, then resets the count
+	uint32_t take_dropped();
+
+private:
+	struct Command {
+		Layer layer;
+		uint8_t index;
+		uint8_t flags;
+		uint8_t alpha;
+		int32_t x;
+		int32_t y;
+	};
+
+	// Sorts the queued commands by layer, then by sprite index
+	// This is an insertion sort, so commands with the same layer and sprite index stay in the order they were added
+	void sort();
+
+	Command commands[Constants::MAX_RENDER_COMMANDS];
+	uint8_t command_count = 0;
+
+	uint8_t draw_calls = 0;
+	uint8_t culled = 0;
+
+	uint32_t dropped = 0;
+};
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "constants.hpp"
+
+// Buckets entities by the tile containing their top-left corner, so that finding the entities near an area only needs to look at a few cells
+// Every entity must fit inside a tile-sized square from its corner, so that anything overlapping a cell has its corner in that cell, or the cell above or to the left
+// The entities in each cell are stored next to each other (using a counting sort), so each row of cells in a query is one contiguous run of indices
+class SpatialGrid {
+public:
+	// Rebuilds the grid from the top-left corners of every entity (entities outside the game area are put in the nearest edge cell)
+	void rebuild(const number_t* x, const number_t* y, uint32_t count);
+
+	// Makes space for the number of entities provided, so that rebuilding the grid doesn't need to reallocate
+	void reserve(uint32_t count);
+
+	// Calls callback(index) for each entity which could be overlapping the area from (left, top) to (right, bottom)
+	// The callback does the exact check, and returns true to stop the search early
+	// Returns true if the search was stopped by the callback
+	template<typename Callback>
+	bool query(number_t left, number_t top, number_t right, number_t bottom, Callback callback) const {
+		// Entities whose corner is in the cell above or to the left of the area can still reach into it
+		uint8_t first_x = std::max(cell(left, Constants::GAME_WIDTH_TILES) - 1, 0);
+		uint8_t first_y = std::max(cell(top, Constants::GAME_HEIGHT_TILES) - 1, 0);
+		uint8_t last_x = cell(right, Constants::GAME_WIDTH_TILES);
+		uint8_t last_y = cell(bottom, Constants::GAME_HEIGHT_TILES);
+
+		for (uint8_t y = first_y; y <= last_y; y++) {
+			uint32_t end = cell_start[y * Constants::GAME_WIDTH_TILES + last_x + 1];
+
+			for (uint32_t i = cell_start[y * Constants::GAME_WIDTH_TILES + first_x]; i < end; i++) {
+				if (callback(entities[i])) {
+					return true;
+				}
+			}
+		}
+
+		return false;
+	}
+
+	// Returns the number of bytes allocated for the grid
+	uint32_t get_memory_usage() const {
+		return sizeof(cell_start) + entities.capacity() * sizeof(uint32_t) + entity_cells.capacity() * sizeof(uint8_t);
+	}
+
+private:
+	static constexpr uint16_t CELL_COUNT = Constants::GAME_WIDTH_TILES * Constants::GAME_HEIGHT_TILES;
+
+	// Returns the row or column of cells containing the position provided, clamped to the grid
+	static int16_t cell(number_t position, uint8_t cell_count) {
+		number_t clamped = std::min(std::max(position, number_t(0)), number_t(cell_count * Constants::SPRITE_SIZE));
+
+		return std::min<int32_t>(to_int(clamped) / Constants::SPRITE_SIZE, cell_count - 1);
+	}
+
+	// The entities in cell c are entities[cell_start[c]] to entities[cell_start[c + 1] - 1]
+	uint32_t cell_start[CELL_COUNT + 1] = {};
+	std::vector<uint32_t> entities;
+
+	// The cell each entity was put in during the last rebuild
+	std::vector<uint8_t> entity_cells;
+};
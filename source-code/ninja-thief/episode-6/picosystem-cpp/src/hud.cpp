@@ -0,0 +1,149 @@
+#include "hud.hpp"
+
+using namespace picosystem;
+
+// The text which is pre-rendered onto the atlas
+// The digits are followed by an extra 0, so that the spacing after the 9 can be measured
+static const char DIGITS[] = "01234567890";
+static const char* const LABELS[] = { "Level: ", "Score: " };
+
+// Memory for the atlas and strip (both have transparent pixels wherever there's no text)
+static color_t atlas_data[Constants::HUD::ATLAS_WIDTH * Constants::HUD::HEIGHT * 3];
+static color_t strip_data[Constants::SCREEN_WIDTH * Constants::HUD::HEIGHT];
+
+buffer_t* Hud::atlas = nullptr;
+buffer_t* Hud::strip = nullptr;
+
+int32_t Hud::digit_offsets[10] = {};
+int32_t Hud::digit_advances[10] = {};
+int32_t Hud::digit_widths[10] = {};
+int32_t Hud::label_advances[2] = {};
+int32_t Hud::text_height = 0;
+
+void Hud::init() {
+    atlas = buffer(Constants::HUD::ATLAS_WIDTH, Constants::HUD::HEIGHT * 3, atlas_data);
+    strip = buffer(Constants::SCREEN_WIDTH, Constants::HUD::HEIGHT, strip_data);
+
+    int32_t w;
+    measure("0", w, text_height);
+
+    // Render the digits onto the first row, and each label onto its own row
+    target(atlas);
+    pen(15, 15, 15);
+
+    text(std::string(DIGITS, 10), 0, 0);
+
+    for (uint8_t i = 0; i < 2; i++) {
+        text(LABELS[i], 0, Constants::HUD::HEIGHT * (i + 1));
+
+        label_advances[i] = advance(LABELS[i], std::strlen(LABELS[i]));
+    }
+
+    target();
+
+    // Work out where each digit ended up
+    for (uint8_t i = 0; i < 10; i++) {
+        digit_offsets[i] = advance(DIGITS, i);
+        digit_advances[i] = advance(DIGITS, i + 1) - digit_offsets[i];
+
+        int32_t h;
+        measure(std::string(DIGITS + i, 1), digit_widths[i], h);
+    }
+}
+
+bool Hud::update(uint8_t _level_number, uint8_t _score) {
+    if (drawn && _level_number == level_number && _score == score) {
+        return false;
+    }
+
+    level_number = _level_number;
+    score = _score;
+    drawn = true;
+
+    redraw();
+
+    return true;
+}
+
+void Hud::render() {
+    blit(strip, 0, 0, Constants::SCREEN_WIDTH, Constants::HUD::HEIGHT, 0, 0);
+}
+
+void Hud::redraw() {
+    // Make the whole strip transparent
+    std::memset(strip_data, 0, sizeof(strip_data));
+
+    target(strip);
+
+    // Level number in top left corner
+    int32_t x = draw_label(Label::LEVEL, Constants::HUD::PADDING);
+    draw_number(level_number, x);
+
+    // Score in top right corner
+    x = Constants::SCREEN_WIDTH - Constants::HUD::PADDING - label_advances[static_cast<uint8_t>(Label::SCORE)] - number_width(score);
+    x = draw_label(Label::SCORE, x);
+    draw_number(score, x);
+
+    target();
+}
+
+int32_t Hud::draw_label(Label label, int32_t x) {
+    uint8_t index = static_cast<uint8_t>(label);
+
+    blit(atlas, 0, Constants::HUD::HEIGHT * (index + 1), label_advances[index], text_height, x, Constants::HUD::PADDING);
+
+    return x + label_advances[index];
+}
+
+int32_t Hud::draw_number(uint8_t number, int32_t x) {
+    uint8_t digits[3];
+    uint8_t count = split_digits(number, digits);
+
+    for (uint8_t i = 0; i < count; i++) {
+        uint8_t digit = digits[i];
+
+        blit(atlas, digit_offsets[digit], 0, digit_advances[digit], text_height, x, Constants::HUD::PADDING);
+
+        x += digit_advances[digit];
+    }
+
+    return x;
+}
+
+int32_t Hud::number_width(uint8_t number) {
+    uint8_t digits[3];
+    uint8_t count = split_digits(number, digits);
+
+    int32_t width = 0;
+
+    // There's no spacing after the last digit
+    for (uint8_t i = 0; i < count - 1; i++) {
+        width += digit_advances[digits[i]];
+    }
+
+    return width + digit_widths[digits[count - 1]];
+}
+
+int32_t Hud::advance(const char* text, uint8_t length) {
+    // There's no spacing after the last character of some text, so measure it with an extra character on the end
+    char buffer[16];
+    std::memcpy(buffer, text, length);
+    buffer[length] = '0';
+
+    int32_t w, h, zero_w;
+    measure(std::string(buffer, length + 1), w, h);
+    measure("0", zero_w, h);
+
+    return w - zero_w;
+}
+
+uint8_t Hud::split_digits(uint8_t number, uint8_t* digits) {
+    uint8_t count = number >= 100 ? 3 : number >= 10 ? 2 : 1;
+
+    for (uint8_t i = count; i > 0; i--) {
+        digits[i - 1] = number % 10;
+        number /= 10;
+    }
+
+    return count;
+}
@@ -0,0 +1,184 @@
+#include "level_pack.hpp"
+
+// Generated from the levels in constants.hpp when the game is built
+#include "packed_levels.hpp"
+
+using namespace picosystem;
+
+LevelPack::LevelPack(const uint8_t* _data) {
+    data = _data;
+}
+
+uint8_t LevelPack::get_level_count() const {
+    return data[0];
+}
+
+bool LevelPack::is_raw() const {
+    return data[1] & FLAG_RAW;
+}
+
+uint32_t LevelPack::get_size() const {
+    return get_offset(get_level_count());
+}
+
+uint32_t LevelPack::get_size(uint8_t level_number) const {
+    return get_offset(level_number + 1) - get_offset(level_number);
+}
+
+const Constants::LevelData* LevelPack::load(uint8_t level_number, Constants::LevelData& level_data, SpawnList& spawns) {
+    const uint8_t* level = data + get_offset(level_number);
+    uint32_t size = get_size(level_number);
+
+    // The layers come after the spawn list
+    uint32_t spawns_size = read_spawns(level, size, spawns);
+
+    const uint8_t* layers = level + spawns_size;
+    uint32_t layers_size = size - spawns_size;
+
+    if (!is_raw()) {
+        decode(layers, layers_size, level_data);
+    }
+    else if (layers_size >= sizeof(Constants::LevelData)) {
+        // The level can be used straight from the pack (LevelData only contains bytes, so it doesn't need aligning)
+        return reinterpret_cast<const Constants::LevelData*>(layers);
+    }
+    else {
+        // Any tiles missing from a damaged pack are left blank
+        std::memcpy(&level_data, layers, layers_size);
+        std::memset(reinterpret_cast<uint8_t*>(&level_data) + layers_size, Constants::Sprites::BLANK_TILE, sizeof(Constants::LevelData) - layers_size);
+    }
+
+    return &level_data;
+}
+
+void LevelPack::load_spawns(uint8_t level_number, SpawnList& spawns) {
+    read_spawns(data + get_offset(level_number), get_size(level_number), spawns);
+}
+
+void LevelPack::load_built_in_spawns(uint8_t level_number, SpawnList& spawns) {
+    read_spawns(LEVEL_SPAWNS + LEVEL_SPAWN_OFFSETS[level_number], LEVEL_SPAWN_OFFSETS[level_number + 1] - LEVEL_SPAWN_OFFSETS[level_number], spawns);
+}
+
+#if defined(LEVEL_PACK) || defined(BENCHMARK_LEVEL_PACK)
+LevelPack LevelPack::built_in() {
+    return LevelPack(PACKED_LEVELS);
+}
+#endif
+
+#ifdef BENCHMARK_LEVEL_PACK
+void LevelPack::benchmark_loading() {
+    const uint16_t REPEATS = 100;
+
+    LevelPack pack = built_in();
+    Constants::LevelData level_data;
+    SpawnList spawns;
+
+    for (uint8_t i = 0; i < pack.get_level_count(); i++) {
+        uint32_t start_time = time_us();
+
+        const Constants::LevelData* level = nullptr;
+
+        for (uint16_t j = 0; j < REPEATS; j++) {
+            level = pack.load(i, level_data, spawns);
+        }
+
+        uint32_t time = time_us() - start_time;
+
+        bool matches = i < Constants::LEVEL_COUNT && std::memcmp(level, &Constants::LEVELS[i], sizeof(Constants::LevelData)) == 0;
+
+        printf("Level %d: %lu bytes packed, %lu ns to load (%s)\n", i + 1, static_cast<unsigned long>(pack.get_size(i)),
+            static_cast<unsigned long>(static_cast<uint64_t>(time) * 1000 / REPEATS), matches ? "matches" : "DOESN'T MATCH");
+    }
+
+    printf("Pack: %lu bytes for %d levels (%s), instead of %lu bytes\n", static_cast<unsigned long>(pack.get_size()), pack.get_level_count(),
+        pack.is_raw() ? "raw" : "compressed", static_cast<unsigned long>(pack.get_level_count() * sizeof(Constants::LevelData)));
+
+    // The compiled-in levels are always used in place
+    printf("Constants::LEVELS: used in place, 0 bytes of RAM\n");
+
+    pack.benchmark("Built-in pack");
+}
+#endif
+
+uint32_t LevelPack::get_offset(uint8_t index) const {
+    // The offsets are read a byte at a time, because they aren't aligned
+    const uint8_t* offset = data + 2 + index * 4;
+
+    return offset[0] | (offset[1] << 8) | (offset[2] << 16) | (static_cast<uint32_t>(offset[3]) << 24);
+}
+
+uint32_t LevelPack::read_spawns(const uint8_t* source, uint32_t size, SpawnList& spawns) {
+    if (size < 2) {
+        spawns.player = SpawnList::NO_SPAWN;
+        spawns.enemy_count = 0;
+
+        return size;
+    }
+
+    const uint16_t TILE_COUNT = Constants::GAME_WIDTH_TILES * Constants::GAME_HEIGHT_TILES;
+
+    // Any tiles outside the level are left out, so that a damaged pack can't place the ninjas off the grid (NO_SPAWN is also outside the level)
+    spawns.player = source[0] < TILE_COUNT ? source[0] : SpawnList::NO_SPAWN;
+    spawns.enemy_count = 0;
+
+    uint8_t enemy_count = std::min<uint32_t>({ source[1], size - 2, sizeof(spawns.enemies) });
+
+    for (uint8_t i = 0; i < enemy_count; i++) {
+        if (source[2 + i] < TILE_COUNT) {
+            spawns.enemies[spawns.enemy_count++] = source[2 + i];
+        }
+    }
+
+    return 2 + enemy_count;
+}
+
+void LevelPack::decode(const uint8_t* source, uint32_t size, Constants::LevelData& level_data) {
+    const uint16_t TILE_COUNT = Constants::GAME_WIDTH_TILES * Constants::GAME_HEIGHT_TILES;
+
+    const uint8_t* source_end = source + size;
+
+    for (uint8_t* layer : { level_data.platforms, level_data.extras, level_data.entity_spawns, level_data.pipes }) {
+        uint8_t* tile = layer;
+        uint8_t* end = layer + TILE_COUNT;
+
+        while (tile < end && source_end - source >= 2) {
+            uint8_t blank_count = std::min<uint32_t>(source[0], end - tile);
+            std::memset(tile, Constants::Sprites::BLANK_TILE, blank_count);
+            tile += blank_count;
+
+            uint8_t tile_count = std::min<uint32_t>({ source[1], static_cast<uint32_t>(end - tile), static_cast<uint32_t>(source_end - source - 2) });
+            std::memcpy(tile, source + 2, tile_count);
+            tile += tile_count;
+
+            source += 2 + tile_count;
+        }
+
+        std::memset(tile, Constants::Sprites::BLANK_TILE, end - tile);
+    }
+}
+
+#ifdef BENCHMARK_LEVEL_PACK
+void LevelPack::benchmark(const char* name) {
+    const uint16_t REPEATS = 100;
+
+    Constants::LevelData level_data;
+    SpawnList spawns;
+    bool in_place = true;
+
+    uint32_t start_time = time_us();
+
+    for (uint16_t j = 0; j < REPEATS; j++) {
+        for (uint8_t i = 0; i < get_level_count(); i++) {
+            in_place &= load(i, level_data, spawns) != &level_data;
+        }
+    }
+
+    uint32_t time = time_us() - start_time;
+
+    // The only RAM used is the LevelData, if the levels aren't used in place
+    uint32_t memory = in_place ? 0 : sizeof(Constants::LevelData);
+
+    printf("%s: %lu ns per level, %lu bytes of RAM\n", name,
+        static_cast<unsigned long>(static_cast<uint64_t>(time) * 1000 / (static_cast<uint64_t>(REPEATS) * get_level_count())), static_cast<unsigned long>(memory));
+}
+#endif
@@ -0,0 +1,173 @@
+#include "ninja_thief.hpp"
+
+using namespace picosystem;
+
+// Our global variables are defined here
+buffer_t* background = nullptr;
+
+uint32_t last_time = 0;
+
+// Time which hasn't been simulated yet, measured in thousandths of a tick
+int32_t tick_accumulator = 0;
+
+// How far through the current tick the game is (from 0 to 1), used to draw the ninjas between ticks
+number_t interpolation = 0;
+
+Level level;
+
+#ifdef RENDER_STATS
+// Used to report the average number of pixels drawn, draw calls made and enemies checked exactly against the player each frame
+uint32_t stats_start_time = 0;
+uint32_t stats_frames = 0;
+uint32_t stats_pixels = 0;
+uint32_t stats_draw_calls = 0;
+uint32_t stats_narrow_phase_tests = 0;
+
+// Sprites which couldn't be drawn because the render queue was full (this should always be 0)
+uint32_t stats_dropped_sprites = 0;
+#endif
+
+// Setup the game
+void init() {
+	// Seed the random number generator
+    std::srand(std::time(0));
+	
+	// Pre-render the text used to show the level number and score
+	Hud::init();
+
+#ifdef PALETTED_ASSETS
+	// The spritesheet is stored as palette indices, but the drawing functions need full colour sprites, so it is expanded into a new buffer
+	buffer_t* sprites = buffer(Constants::SPRITESHEET_WIDTH, Constants::SPRITESHEET_HEIGHT);
+
+	for (uint32_t i = 0; i < Constants::SPRITESHEET_WIDTH * Constants::SPRITESHEET_HEIGHT; i++) {
+		sprites->data[i] = asset_spritesheet_palette[palette_index(asset_spritesheet_data, asset_spritesheet_bits, i)];
+	}
+#else
+	// Load the spritesheet
+	buffer_t* sprites = buffer(Constants::SPRITESHEET_WIDTH, Constants::SPRITESHEET_HEIGHT, asset_spritesheet);
+#endif
+
+	// Set the current spritesheet to the one we just loaded
+	spritesheet(sprites);
+
+#ifndef PALETTED_ASSETS
+	// Load the background (when PALETTED_ASSETS is defined, the level draws it straight from the palette indices instead)
+	background = buffer(Constants::SCREEN_WIDTH, Constants::SCREEN_HEIGHT, asset_background);
+#endif
+
+#if defined(PALETTED_ASSETS) && defined(RENDER_STATS)
+	// The full colour images were copied into RAM, as well as being stored in flash
+	// The paletted images are only stored in flash, and only the spritesheet is expanded into RAM
+	uint32_t full_colour_size = (Constants::SCREEN_WIDTH * Constants::SCREEN_HEIGHT + Constants::SPRITESHEET_WIDTH * Constants::SPRITESHEET_HEIGHT) * sizeof(color_t);
+	uint32_t paletted_size = sizeof(asset_background_palette) + sizeof(asset_background_data) + sizeof(asset_spritesheet_palette) + sizeof(asset_spritesheet_data);
+
+	printf("Paletted assets save %lu bytes of flash and %lu bytes of RAM\n", static_cast<unsigned long>(full_colour_size - paletted_size),
+		static_cast<unsigned long>(Constants::SCREEN_WIDTH * Constants::SCREEN_HEIGHT * sizeof(color_t)));
+#endif
+
+	// Create the buffer which each level draws its static layers onto
+	Level::init_static_layers(background, sprites);
+
+#ifdef BENCHMARK_TILE_RENDERING
+	Level::benchmark_tile_rendering();
+#endif
+
+#ifdef VERIFY_FIXED_POINT
+	Ninja::verify_fixed_point();
+#endif
+
+#ifdef BENCHMARK_COLLISIONS
+	Ninja::benchmark_collisions();
+#endif
+
+#ifdef BENCHMARK_ENEMIES
+	Enemies::benchmark_update();
+#endif
+
+#ifdef BENCHMARK_STRESS
+	Level::benchmark_stress();
+#endif
+
+#ifdef BENCHMARK_LEVEL_PACK
+	LevelPack::benchmark_loading();
+#endif
+
+#ifdef BENCHMARK_RESTART
+	Level::benchmark_restart();
+#endif
+
+	// Load the first level
+	level = Level(0);
+}
+
+// Update the game
+void update(uint32_t tick) {
+	// Calculate change in time (in milliseconds) since last frame
+	// The time() function returns the time in milliseconds since the device started
+	uint32_t dt = time() - last_time;
+	last_time = time();
+
+	// Multiplying by the tick rate converts from milliseconds to thousandths of a tick, so no rounding errors build up
+	tick_accumulator += dt * Constants::Simulation::TICK_RATE;
+
+	// Limit the number of ticks, so that the game slows down instead of trying to catch up after a slow frame
+	tick_accumulator = std::min<int32_t>(tick_accumulator, Constants::Simulation::MAX_TICKS_PER_FRAME * 1000);
+
+	// Handle any buttons pressed this frame
+	level.handle_input();
+
+	// Update the level in fixed steps, so that the game plays the same at any frame rate
+	while (tick_accumulator >= 1000) {
+		tick_accumulator -= 1000;
+
+		// Update level
+		level.update(Constants::Simulation::TICK_DURATION);
+
+		if (level.level_failed()) {
+			// Restart the same level
+			uint8_t level_number = level.get_level_number();
+
+			level = Level(level_number);
+		}
+		else if (level.level_complete()) {
+			// Start the next level
+			uint8_t level_number = level.get_level_number() + 1;
+			level_number %= Level::get_level_count();
+
+			level = Level(level_number);
+		}
+	}
+
+	// The time left over is how far the game is through the next tick
+	interpolation = number_t(tick_accumulator) / 1000;
+}
+
+// Render the game
+void draw(uint32_t tick) {
+	// Render the level (this covers the whole screen, including the background, so we don't need to clear the screen first)
+	level.render(interpolation);
+
+#ifdef RENDER_STATS
+	stats_frames++;
+	stats_pixels += level.get_pixels_drawn();
+	stats_draw_calls += level.get_draw_calls();
+	stats_narrow_phase_tests += level.get_narrow_phase_tests();
+	stats_dropped_sprites += level.get_dropped_sprites();
+
+	// Print the statistics once per second
+	if (time() - stats_start_time >= 1000) {
+		printf("Pixels drawn per frame: %lu, draw calls per frame: %lu, narrow-phase tests per frame: %lu\n", static_cast<unsigned long>(stats_pixels / stats_frames), static_cast<unsigned long>(stats_draw_calls / stats_frames), static_cast<unsigned long>(stats_narrow_phase_tests / stats_frames));
+
+		if (stats_dropped_sprites > 0) {
+			printf("Sprites dropped because the render queue was full: %lu\n", static_cast<unsigned long>(stats_dropped_sprites));
+		}
+
+		stats_start_time = time();
+		stats_frames = 0;
+		stats_pixels = 0;
+		stats_draw_calls = 0;
+		stats_narrow_phase_tests = 0;
+		stats_dropped_sprites = 0;
+	}
+#endif
+}
\ No newline at end of file
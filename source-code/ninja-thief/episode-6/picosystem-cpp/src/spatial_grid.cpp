@@ -0,0 +1,33 @@
+#include "spatial_grid.hpp"
+
+void SpatialGrid::rebuild(const number_t* x, const number_t* y, uint32_t count) {
+    entities.resize(count);
+    entity_cells.resize(count);
+
+    std::fill(std::begin(cell_start), std::end(cell_start), 0);
+
+    // Count the entities in each cell
+    for (uint32_t i = 0; i < count; i++) {
+        uint8_t entity_cell = cell(y[i], Constants::GAME_HEIGHT_TILES) * Constants::GAME_WIDTH_TILES + cell(x[i], Constants::GAME_WIDTH_TILES);
+
+        entity_cells[i] = entity_cell;
+        cell_start[entity_cell]++;
+    }
+
+    // Add up the counts, so that each cell's entry points just past the end of its entities
+    for (uint16_t i = 1; i < CELL_COUNT; i++) {
+        cell_start[i] += cell_start[i - 1];
+    }
+
+    cell_start[CELL_COUNT] = count;
+
+    // Fill each cell from the back, which leaves its entry pointing at its first entity (and keeps the entities in each cell in order)
+    for (uint32_t i = count; i > 0; i--) {
+        entities[--cell_start[entity_cells[i - 1]]] = i - 1;
+    }
+}
+
+void SpatialGrid::reserve(uint32_t count) {
+    entities.reserve(count);
+    entity_cells.reserve(count);
+}
@@ -0,0 +1,47 @@
+#include "tile_masks.hpp"
+
+TileMasks::TileMasks() {
+
+}
+
+TileMasks::TileMasks(const Constants::LevelData& level_data) {
+    for (uint8_t y = 0; y < Constants::GAME_HEIGHT_TILES; y++) {
+        for (uint8_t x = 0; x < Constants::GAME_WIDTH_TILES; x++) {
+            uint8_t array_position = y * Constants::GAME_WIDTH_TILES + x;
+
+            uint8_t platform_id = level_data.platforms[array_position];
+            uint8_t extra_id = level_data.extras[array_position];
+
+            uint16_t bit = 1 << x;
+
+            // Platforms with a ladder in front of them can be climbed through, so they're kept separate from the solid platforms
+            if (platform_id != Constants::Sprites::BLANK_TILE) {
+                rows[static_cast<uint8_t>(extra_id == Constants::Sprites::LADDER ? Mask::ONE_WAY : Mask::SOLID)][y] |= bit;
+                rows[static_cast<uint8_t>(Mask::PLATFORM)][y] |= bit;
+            }
+
+            if (extra_id == Constants::Sprites::LADDER) {
+                rows[static_cast<uint8_t>(Mask::LADDER)][y] |= bit;
+            }
+            else if (extra_id == Constants::Sprites::COIN) {
+                rows[static_cast<uint8_t>(Mask::COIN)][y] |= bit;
+            }
+            else if (extra_id == Constants::Sprites::GEM) {
+                rows[static_cast<uint8_t>(Mask::GEM)][y] |= bit;
+            }
+        }
+    }
+}
+
+uint8_t TileMasks::count(Mask mask) const {
+    uint8_t total = 0;
+
+    for (uint8_t y = 0; y < Constants::GAME_HEIGHT_TILES; y++) {
+        // Clear the lowest set bit until there are none left
+        for (uint16_t bits = row(mask, y); bits; bits &= bits - 1) {
+            total++;
+        }
+    }
+
+    return total;
+}